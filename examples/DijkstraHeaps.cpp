@@ -0,0 +1,211 @@
+#include <iostream>
+#include <chrono>
+#include <queue>
+#include <random>
+#include <type_traits>
+#include <graphlib/gl>
+
+/**
+ * Compares the priority queues for single source Dijkstra searches:
+ * a std::priority_queue of (Distance, node) pairs with lazy deletion against indexed d-ary heaps with decrease-key,
+ * and on integer weights additionally Dial's bucket queue and a radix heap. On the dense graph, the O(n^2) linear scan
+ * over the rows of the adjacency matrix is compared as well.
+ * Runs on the Swiss road network (sparse, also with weights scaled to integers) and on a random dense graph.
+ * Pass in the number of searches per queue as command line argument (default 20).
+ * Example: ./DijkstraHeaps 50
+ */
+
+// lazy deletion: every improvement pushes a new entry, stale entries are skipped when popped
+template <class Graph>
+double lazyDistanceQueue(const Graph &g, gl::index_type src, std::size_t &maxSize)
+{
+    using pair_t = std::pair<gl::Distance<double>, gl::index_type>;
+    auto greater = [](pair_t lhs, pair_t rhs) { return lhs.first > rhs.first; };
+    std::priority_queue<pair_t, std::vector<pair_t>, decltype(greater)> pq(greater);
+    std::vector<gl::Distance<double>> distance(g.numNodes());
+    std::vector<bool> visited(g.numNodes(), false);
+    typename Graph::dest_vec_t neighbours;
+    distance[src] = gl::Distance<double>(0.);
+    pq.push({distance[src], src});
+    while (!pq.empty())
+    {
+        maxSize = std::max(maxSize, pq.size());
+        auto u = pq.top().second;
+        pq.pop();
+        if (visited[u])
+            continue;
+        visited[u] = true;
+        g.getNeighbourWeights(u, neighbours);
+        for (const auto &x : neighbours)
+        {
+            gl::Distance<double> candidate = distance[u] + gl::Distance<double>(x.second);
+            if (distance[x.first] > candidate)
+            {
+                distance[x.first] = candidate;
+                pq.push({candidate, x.first});
+            }
+        }
+    }
+    return distance[g.numNodes() - 1].scalarDistance();
+}
+
+// decrease-key: at most one entry per node
+template <unsigned ARITY, class Graph>
+double indexedHeap(const Graph &g, gl::index_type src, std::size_t &maxSize)
+{
+    gl::IndexedDaryHeap<double, ARITY> heap(g.numNodes());
+    std::vector<double> distance(g.numNodes(), GL_INF(double));
+    std::vector<bool> settled(g.numNodes(), false);
+    typename Graph::dest_vec_t neighbours;
+    distance[src] = 0.;
+    heap.push(src, 0.);
+    while (!heap.empty())
+    {
+        maxSize = std::max(maxSize, std::size_t(heap.size()));
+        auto top = heap.pop();
+        settled[top.second] = true;
+        g.getNeighbourWeights(top.second, neighbours);
+        for (const auto &x : neighbours)
+        {
+            double candidate = top.first + x.second;
+            if (!settled[x.first] && candidate < distance[x.first])
+            {
+                distance[x.first] = candidate;
+                heap.pushOrDecrease(x.first, candidate);
+            }
+        }
+    }
+    return distance[g.numNodes() - 1];
+}
+
+// dense graphs: no queue at all, the next node is found by scanning the distance array
+template <class Graph>
+double linearScan(const Graph &g, gl::index_type src, std::size_t &maxSize)
+{
+    const gl::index_type n = g.numNodes();
+    std::vector<double> key(n, GL_INF(double)), distance(n, GL_INF(double));
+    std::vector<bool> settled(n, false);
+    key[src] = distance[src] = 0.;
+    maxSize = std::max(maxSize, std::size_t(n));
+    for (;;)
+    {
+        double best = GL_INF(double);
+        for (gl::index_type v = 0; v < n; ++v)
+            best = key[v] < best ? key[v] : best;
+        if (best == GL_INF(double))
+            break;
+        gl::index_type u = 0;
+        while (key[u] != best)
+            ++u;
+        key[u] = GL_INF(double);
+        settled[u] = true;
+        const auto *row = g.getEdgeRow(u);
+        for (gl::index_type v = 0; v < n; ++v)
+        {
+            if (row[v].exists() && !settled[v] && best + row[v].weight() < distance[v])
+                key[v] = distance[v] = best + row[v].weight();
+        }
+    }
+    return distance[n - 1];
+}
+
+// monotone integer queues: lazy deletion, popped keys never decrease
+template <class Queue, class Graph>
+double monotoneQueue(const Graph &g, gl::index_type src, std::size_t &maxSize)
+{
+    using val_t = typename Graph::val_t;
+    Queue queue = [&g]() {
+        if constexpr (std::is_constructible_v<Queue, val_t>)
+            return Queue(g.maxEdgeWeight());
+        else
+            return Queue();
+    }();
+    std::vector<val_t> distance(g.numNodes(), GL_INF(val_t));
+    std::vector<bool> settled(g.numNodes(), false);
+    typename Graph::dest_vec_t neighbours;
+    distance[src] = 0;
+    queue.push(0, src);
+    while (!queue.empty())
+    {
+        maxSize = std::max(maxSize, std::size_t(queue.size()));
+        auto top = queue.pop();
+        if (settled[top.second])
+            continue;
+        settled[top.second] = true;
+        g.getNeighbourWeights(top.second, neighbours);
+        for (const auto &x : neighbours)
+        {
+            val_t candidate = top.first + x.second;
+            if (candidate < distance[x.first])
+            {
+                distance[x.first] = candidate;
+                queue.push(candidate, x.first);
+            }
+        }
+    }
+    return distance[g.numNodes() - 1] == GL_INF(val_t) ? 0. : double(distance[g.numNodes() - 1]);
+}
+
+template <class Graph, class Search>
+void run(const std::string &name, const Graph &g, const std::vector<gl::index_type> &sources, Search search)
+{
+    std::size_t maxSize = 0;
+    double checksum = 0.;
+    auto start = std::chrono::steady_clock::now();
+    for (auto src : sources)
+        checksum += search(g, src, maxSize);
+    double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "  " << name << time / sources.size() << " ms/search, max. queue size " << maxSize << ", checksum " << checksum << std::endl;
+}
+
+template <class Graph>
+std::vector<gl::index_type> randomSources(const Graph &g, std::size_t numSearches)
+{
+    std::mt19937 gen(37);
+    std::uniform_int_distribution<gl::index_type> node(0, g.numNodes() - 1);
+    std::vector<gl::index_type> sources;
+    for (std::size_t i = 0; i < numSearches; ++i)
+        sources.push_back(node(gen));
+    return sources;
+}
+
+template <class Graph>
+void compare(const std::string &title, const Graph &g, std::size_t numSearches)
+{
+    auto sources = randomSources(g, numSearches);
+    std::cout << title << ": " << g.numNodes() << " nodes, " << g.numEdges() << " edges" << std::endl;
+    run("lazy Distance queue: ", g, sources, lazyDistanceQueue<Graph>);
+    run("indexed 2-ary heap:  ", g, sources, indexedHeap<2, Graph>);
+    run("indexed 4-ary heap:  ", g, sources, indexedHeap<4, Graph>);
+    run("indexed 8-ary heap:  ", g, sources, indexedHeap<8, Graph>);
+}
+
+int main(int argc, char const *argv[])
+{
+    std::size_t numSearches = argc == 2 ? std::stoul(argv[1]) : 20;
+
+    gl::io::YAMLReader reader("examples/input/switzerland.yml"); // assumes running from project root folder
+    auto swiss = *std::get<gl::graphLdu *>(reader.get());
+    compare("Switzerland", swiss, numSearches);
+
+    gl::graphLiu integral(swiss.numNodes(), "Switzerland, integer weights");
+    for (auto it = swiss.edge_cbegin(); it != swiss.edge_cend(); ++it)
+        if (it->source() < it->dest())
+            integral.setEdge(it->source(), it->dest(), std::max(1, int(it->weight() * 1000. + 0.5)));
+    auto sources = randomSources(integral, numSearches);
+    std::cout << integral.getGraphLabel() << ": max. weight " << integral.maxEdgeWeight() << std::endl;
+    run("indexed 4-ary heap:  ", integral, sources, indexedHeap<4, gl::graphLiu>);
+    run("radix heap:          ", integral, sources, monotoneQueue<gl::RadixHeap<int>, gl::graphLiu>);
+    run("bucket queue (Dial): ", integral, sources, monotoneQueue<gl::BucketQueue<int>, gl::graphLiu>);
+
+    gl::graphMdd dense(1500, "Dense");
+    std::mt19937 gen(2019);
+    std::uniform_real_distribution<double> weight(1., 100.);
+    for (gl::index_type u = 0; u < dense.numNodes(); ++u)
+        for (gl::index_type v = 0; v < dense.numNodes(); ++v)
+            if (u != v)
+                dense.setEdge(u, v, weight(gen));
+    compare("Random complete graph", dense, numSearches);
+    run("linear scan (rows):  ", dense, randomSources(dense, numSearches), linearScan<gl::graphMdd>);
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <graphlib/gl>
+
+/**
+ * Compares single source shortest path searches of Dijkstra with delta-stepping on 1, 2, 4, ... threads
+ * (up to the number of hardware threads) on a random sparse graph.
+ * Pass in the number of nodes as command line argument (default 200000), the graph has 5 edges per node.
+ * Example: ./ParallelSSSP 1000000
+ */
+
+template <class Search>
+double time(Search search)
+{
+    auto start = std::chrono::steady_clock::now();
+    search();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char const *argv[])
+{
+    gl::index_type numNodes = argc == 2 ? std::stoul(argv[1]) : 200000;
+
+    gl::graphLdd g(numNodes, "Random");
+    std::mt19937 gen(39);
+    std::uniform_int_distribution<gl::index_type> node(0, numNodes - 1);
+    std::uniform_real_distribution<double> weight(1., 100.);
+    for (gl::index_type i = 0; i < 5 * numNodes; ++i)
+    {
+        gl::index_type u = node(gen), v = node(gen);
+        if (u != v && !g.hasEdge(u, v))
+            g.setEdge(u, v, weight(gen));
+    }
+    std::cout << g.numNodes() << " nodes, " << g.numEdges() << " edges" << std::endl;
+
+    std::vector<gl::Distance<double>> expected, distances;
+    gl::algorithm::dijkstraLdd dijkstra(g);
+    std::cout << "Dijkstra:                 " << time([&]() { dijkstra.queryDistances(0, expected); }) << " ms" << std::endl;
+
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned numThreads = 1; numThreads <= hardware; numThreads *= 2)
+    {
+        gl::algorithm::deltaSteppingLdd deltaStepping(g, numThreads);
+        deltaStepping.delta(); // builds the light/heavy adjacency arrays
+        double ms = time([&]() { deltaStepping.queryDistances(0, distances); });
+        bool equal = true;
+        for (gl::index_type v = 0; v < numNodes; ++v)
+            equal = equal && distances[v] == expected[v];
+        std::cout << "Delta-stepping, " << numThreads << " thread(s): " << ms << " ms (delta " << deltaStepping.delta()
+                  << (equal ? ", same distances)" : ", DIFFERENT distances)") << std::endl;
+    }
+    return 0;
+}
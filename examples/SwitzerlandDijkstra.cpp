@@ -7,9 +7,6 @@ int main(int argc, char const *argv[])
 
     auto g = *std::get<gl::graphLdu *>(reader.get());
 
-    gl::index_type source = g.numNodes();
-    gl::index_type dest = g.numNodes();
-
     /**
      * Pass in two command line arguments to change the Dijkstra targets.
      * Accepted are (probably) any two Swiss Post Codes.
@@ -20,30 +17,19 @@ int main(int argc, char const *argv[])
 
     g.setGraphLabel("Route from " + source_label + " to " + target_label);
 
-    for (auto it = g.node_cbegin(); it != g.node_cend(); it++)
-    {
-        if (it->label() == source_label)
-        {
-            source = it->id();
-            break;
-        }
-    }
-    for (auto it = g.node_cbegin(); it != g.node_cend(); it++)
-    {
-        if (it->label() == target_label)
-        {
-            dest = it->id();
-            break;
-        }
-    }
-    if(source == g.numNodes()) {
+    g.enableLabelIndex();
+    auto source_match = g.findNode(source_label);
+    auto dest_match = g.findNode(target_label);
+    if(!source_match.first) {
         std::cout << "Source location not found." << std::endl;
         return 1;
     }
-    if(dest == g.numNodes()) {
+    if(!dest_match.first) {
         std::cout << "Destination location not found." << std::endl;
         return 1;
     }
+    gl::index_type source = source_match.second;
+    gl::index_type dest = dest_match.second;
 
     gl::algorithm::dijkstraLdu dijkstra(g);
     auto path = dijkstra.getPath(source,dest).second;
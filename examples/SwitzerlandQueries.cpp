@@ -0,0 +1,157 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <graphlib/gl>
+
+/**
+ * Benchmarks point-to-point shortest path queries on the Swiss road network.
+ * Pass in the number of random queries as command line argument (default 20).
+ * Example: ./SwitzerlandQueries 50
+ */
+int main(int argc, char const *argv[])
+{
+    gl::io::YAMLReader reader("examples/input/switzerland.yml");  // assumes running from project root folder
+
+    auto g = *std::get<gl::graphLdu *>(reader.get());
+    std::size_t numQueries = argc == 2 ? std::stoul(argv[1]) : 20;
+
+    std::mt19937 gen(2019);
+    std::uniform_int_distribution<gl::index_type> node(0, g.numNodes() - 1);
+    std::vector<std::pair<gl::index_type, gl::index_type>> queries;
+    for (std::size_t i = 0; i < numQueries; ++i)
+        queries.emplace_back(node(gen), node(gen));
+
+    using clock = std::chrono::steady_clock;
+    std::vector<double> full, pointToPoint, bidirectional, aStar, landmarks, hierarchy, labels;
+
+    // full single source computation (a fresh object per query, so nothing is cached)
+    auto start = clock::now();
+    for (const auto &q : queries)
+    {
+        gl::algorithm::dijkstraLdu dijkstra(g);
+        full.push_back(dijkstra.pathLength(q.first, q.second).scalarDistance());
+    }
+    double fullTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+    // early terminating point-to-point queries sharing one workspace
+    gl::algorithm::dijkstraLdu dijkstra(g);
+    start = clock::now();
+    for (const auto &q : queries)
+        pointToPoint.push_back(dijkstra.queryLength(q.first, q.second).scalarDistance());
+    double queryTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+    // bidirectional search, counting the settled nodes
+    gl::algorithm::bidirectionalDijkstraLdu bidir(g);
+    std::size_t settled = 0;
+    start = clock::now();
+    for (const auto &q : queries)
+    {
+        bidirectional.push_back(bidir.pathLength(q.first, q.second).scalarDistance());
+        settled += bidir.numSettled();
+    }
+    double bidirTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+    // A* guided by the straight-line distance, scaled down so that it never overestimates
+    gl::algorithm::AStar<gl::graphLdu> astar(g, gl::algorithm::EuclideanHeuristic(gl::algorithm::EuclideanHeuristic::admissibleScale(g)));
+    std::size_t astarSettled = 0;
+    start = clock::now();
+    for (const auto &q : queries)
+    {
+        aStar.push_back(astar.pathLength(q.first, q.second).scalarDistance());
+        astarSettled += astar.numSettled();
+    }
+    double astarTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+    // ALT: A* with lower bounds from 16 landmarks
+    start = clock::now();
+    gl::algorithm::LandmarkHeuristic<gl::graphLdu> heuristic(g, 16, gl::algorithm::LandmarkSelection::Avoid);
+    double altBuildTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    gl::algorithm::altLdu alt(g, heuristic);
+    std::size_t altSettled = 0;
+    start = clock::now();
+    for (const auto &q : queries)
+    {
+        landmarks.push_back(alt.pathLength(q.first, q.second).scalarDistance());
+        altSettled += alt.numSettled();
+    }
+    double altTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+    // contraction hierarchies: preprocessing once, then upward searches
+    start = clock::now();
+    gl::algorithm::contractionHierarchiesLdu ch(g);
+    double chBuildTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    std::size_t chSettled = 0;
+    start = clock::now();
+    for (const auto &q : queries)
+    {
+        hierarchy.push_back(ch.pathLength(q.first, q.second).scalarDistance());
+        chSettled += ch.numSettled();
+    }
+    double chTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+    // the bidirectional search adds up the two halves of a path, so allow for rounding differences
+    auto same = [](const std::vector<double> &lhs, const std::vector<double> &rhs) {
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+            if (std::abs(lhs[i] - rhs[i]) > 1e-9 * std::max(1., std::abs(lhs[i])))
+                return false;
+        return true;
+    };
+    // hub labels in the reversed contraction order: distances only
+    gl::index_type n = g.numNodes();
+    gl::graphLdu::idx_list_t order(n);
+    for (gl::index_type u = 0; u < n; ++u)
+        order[n - 1 - ch.rank(u)] = u;
+    start = clock::now();
+    gl::algorithm::hubLabelsLdu hubLabels(g, order);
+    double hlBuildTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    start = clock::now();
+    for (const auto &q : queries)
+        labels.push_back(hubLabels.pathLength(q.first, q.second).scalarDistance());
+    double hlTime = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+
+    // distance tables between all query sources and all query targets
+    gl::graphLdu::idx_list_t sources, targets;
+    for (const auto &q : queries)
+    {
+        sources.push_back(q.first);
+        targets.push_back(q.second);
+    }
+    std::vector<double> pairwise, table, bucketTable;
+    start = clock::now();
+    for (auto s : sources)
+        for (auto t : targets)
+            pairwise.push_back(dijkstra.queryLength(s, t).scalarDistance());
+    double pairwiseTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    start = clock::now();
+    auto searchTable = gl::algorithm::manyToManyLdu(g).distanceTable(sources, targets);
+    double tableTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    start = clock::now();
+    auto chTable = ch.distanceTable(sources, targets);
+    double bucketTime = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    for (std::size_t i = 0; i < searchTable.data().size(); ++i)
+    {
+        table.push_back(searchTable.data()[i].scalarDistance());
+        bucketTable.push_back(chTable.data()[i].scalarDistance());
+    }
+
+    bool match = same(full, pointToPoint) && same(full, bidirectional) && same(full, aStar) && same(full, landmarks) && same(full, hierarchy) && same(full, labels)
+              && same(pairwise, table) && same(pairwise, bucketTable);
+    std::cout << "Nodes: " << g.numNodes() << ", queries: " << numQueries << std::endl;
+    std::cout << "Full computation:  " << fullTime / numQueries << " ms/query, " << g.numNodes() << " settled nodes/query" << std::endl;
+    std::cout << "Point-to-point:    " << queryTime / numQueries << " ms/query" << std::endl;
+    std::cout << "Bidirectional:     " << bidirTime / numQueries << " ms/query, " << settled / numQueries << " settled nodes/query" << std::endl;
+    std::cout << "A*:                " << astarTime / numQueries << " ms/query, " << astarSettled / numQueries << " settled nodes/query" << std::endl;
+    std::cout << "ALT preprocessing: " << altBuildTime << " ms, " << heuristic.memoryUsage() / 1024 << " KiB" << std::endl;
+    std::cout << "ALT:               " << altTime / numQueries << " ms/query, " << altSettled / numQueries << " settled nodes/query" << std::endl;
+    std::cout << "CH preprocessing:  " << chBuildTime << " ms, " << ch.numShortcuts() << " shortcuts" << std::endl;
+    std::cout << "CH:                " << chTime / numQueries << " ms/query, " << chSettled / numQueries << " settled nodes/query" << std::endl;
+    std::cout << "HL preprocessing:  " << hlBuildTime << " ms, " << hubLabels.averageLabelSize() << " entries/label, " << hubLabels.memoryUsage() / 1024 << " KiB" << std::endl;
+    std::cout << "HL:                " << hlTime / numQueries << " us/query" << std::endl;
+    std::cout << "Table " << numQueries << "x" << numQueries << ":" << std::endl;
+    std::cout << "  pairwise:        " << pairwiseTime << " ms" << std::endl;
+    std::cout << "  per source:      " << tableTime << " ms" << std::endl;
+    std::cout << "  CH buckets:      " << bucketTime << " ms" << std::endl;
+    std::cout << "Results " << (match ? "match" : "DIFFER") << std::endl;
+    return match ? 0 : 1;
+}
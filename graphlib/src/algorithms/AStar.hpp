@@ -0,0 +1,307 @@
+#ifndef GL_ASTAR_HPP
+#define GL_ASTAR_HPP
+
+#include "../gl_base.hpp"
+#include "../structures/SearchWorkspace.hpp"
+#include "../structures/SharedGraph.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace gl::algorithm {
+
+///////////////////////////////////////////////////////////
+//    Heuristics
+///////////////////////////////////////////////////////////
+
+/**
+ * A heuristic is any callable `double (const Graph& graph, idx_t node, idx_t target)` that estimates the distance from node to target.
+ * A* returns shortest paths if the heuristic never overestimates the length of an edge: h(u) <= w(u,v) + h(v) (consistency).
+ * @class EuclideanHeuristic
+ * @brief Straight-line distance between the node positions, multiplied by a scale.
+ */
+class EuclideanHeuristic {
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] scale Factor converting position distances to edge weights. Use admissibleScale() if unknown.
+   */
+  explicit EuclideanHeuristic(const double scale = 1.) : scale_(scale) {}
+  /**
+   * @brief Estimates the distance from node to target.
+   * @param[in] graph Graph that provides the node positions
+   * @param[in] node Node ID
+   * @param[in] target Target node ID
+   * @return scale * Euclidean distance of the positions.
+   */
+  template <class Graph>
+  double operator()(const Graph& graph, const typename Graph::idx_t node, const typename Graph::idx_t target) const
+  {
+    return scale_ * distance(graph.getNodePosition(node), graph.getNodePosition(target));
+  }
+  /**
+   * @brief Euclidean distance between two positions.
+   */
+  static double distance(const std::pair<float,float>& lhs, const std::pair<float,float>& rhs)
+  {
+    return std::hypot(double(lhs.first) - rhs.first, double(lhs.second) - rhs.second);
+  }
+  /**
+   * @brief Largest scale for which the heuristic is consistent on the given graph. O(E).
+   * @param[in] graph Graph that provides edge weights and node positions
+   * @return min over all edges of weight / Euclidean length (edges of length 0 are ignored).
+   */
+  template <class Graph>
+  static double admissibleScale(const Graph& graph);
+
+private:
+  double scale_; ///< @brief Factor converting position distances to edge weights
+};
+
+/**
+ * Node positions are interpreted as (longitude, latitude) in degrees.
+ * @class HaversineHeuristic
+ * @brief Great-circle distance between the node positions, multiplied by a scale.
+ */
+class HaversineHeuristic {
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] scale Factor converting great-circle distances (in units of radius) to edge weights. Use admissibleScale() if unknown.
+   * @param[in] radius Radius of the sphere, by default the mean earth radius in km.
+   */
+  explicit HaversineHeuristic(const double scale = 1., const double radius = 6371.0088) : scale_(scale), radius_(radius) {}
+  /**
+   * @brief Estimates the distance from node to target.
+   * @param[in] graph Graph that provides the node positions
+   * @param[in] node Node ID
+   * @param[in] target Target node ID
+   * @return scale * great-circle distance of the positions.
+   */
+  template <class Graph>
+  double operator()(const Graph& graph, const typename Graph::idx_t node, const typename Graph::idx_t target) const
+  {
+    return scale_ * distance(graph.getNodePosition(node), graph.getNodePosition(target), radius_);
+  }
+  /**
+   * @brief Great-circle distance between two (longitude, latitude) positions in degrees.
+   */
+  static double distance(const std::pair<float,float>& lhs, const std::pair<float,float>& rhs, const double radius = 6371.0088)
+  {
+    const double toRadians = std::acos(-1.) / 180.;
+    double lat1 = lhs.second * toRadians, lat2 = rhs.second * toRadians;
+    double dLat = lat2 - lat1, dLon = (double(rhs.first) - lhs.first) * toRadians;
+    double a = std::sin(dLat/2) * std::sin(dLat/2) + std::cos(lat1) * std::cos(lat2) * std::sin(dLon/2) * std::sin(dLon/2);
+    return 2 * radius * std::asin(std::min(1., std::sqrt(a)));
+  }
+  /**
+   * @brief Largest scale for which the heuristic is consistent on the given graph. O(E).
+   * @param[in] graph Graph that provides edge weights and node positions
+   * @param[in] radius Radius of the sphere
+   * @return min over all edges of weight / great-circle length (edges of length 0 are ignored).
+   */
+  template <class Graph>
+  static double admissibleScale(const Graph& graph, const double radius = 6371.0088);
+
+private:
+  double scale_;  ///< @brief Factor converting great-circle distances to edge weights
+  double radius_; ///< @brief Radius of the sphere
+};
+
+/**
+ * @class ZeroHeuristic
+ * @brief Heuristic without information. A* then behaves like Dijkstra.
+ */
+class ZeroHeuristic {
+public:
+  /**
+   * @brief Estimates the distance from node to target.
+   * @return 0
+   */
+  template <class Graph>
+  double operator()(const Graph&, const typename Graph::idx_t, const typename Graph::idx_t) const { return 0.; }
+};
+
+///////////////////////////////////////////////////////////
+//    Class declaration
+///////////////////////////////////////////////////////////
+
+/**
+ * Like Dijkstra, but nodes are explored in the order of distance from src plus the heuristic's estimate of the distance to dest,
+ * which steers the search towards dest. With a consistent heuristic the results equal those of Dijkstra.
+ * For integral edge weights, the estimates are rounded down, which keeps them consistent.
+ * @class AStar
+ * @brief Point-to-point shortest paths with the A* algorithm.
+ * @tparam Graph Graph type
+ * @tparam Heuristic Callable `double (const Graph&, idx_t node, idx_t target)`, see EuclideanHeuristic.
+ */
+template <class Graph, class Heuristic = EuclideanHeuristic>
+class AStar {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+  /**
+   * The graph is not copied, it has to outlive the AStar object.
+   * @brief Initialized Constructor.
+   * @param[in] graph Graph that will be searched
+   * @param[in] heuristic Estimate of the remaining distance
+   */
+  explicit AStar(const Graph& graph, const Heuristic& heuristic = Heuristic());
+  /**
+   * @brief Initialized Constructor. Takes ownership of a temporary graph.
+   * @param[in] graph Graph that will be searched
+   * @param[in] heuristic Estimate of the remaining distance
+   */
+  explicit AStar(Graph&& graph, const Heuristic& heuristic = Heuristic());
+  /**
+   * @brief Initialized Constructor. Shares the ownership of the graph with the given handle.
+   * @param[in] graph Handle to the graph that will be searched
+   * @param[in] heuristic Estimate of the remaining distance
+   */
+  explicit AStar(const SharedGraph<Graph>& graph, const Heuristic& heuristic = Heuristic());
+
+  AStar(const AStar &) = default;                ///< Copy constructor
+  AStar(AStar &&) noexcept = default;            ///< Move constructor
+  AStar &operator=(const AStar &) = default;     ///< Copy assignment
+  AStar &operator=(AStar &&) noexcept = default; ///< Move assignment
+  ~AStar() = default;                            ///< Default destructor
+
+  /**
+   * @brief Computes the length of the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return Length of the shortest path, infinite if dest is unreachable.
+   */
+  Distance<val_t> pathLength(const idx_t src, const idx_t dest);
+  /**
+   * @brief Computes the node sequence that represents the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return pair of (true, path) if dest is reachable, (false, {}) otherwise.
+   */
+  std::pair<bool,idx_list_t> getPath(const idx_t src, const idx_t dest);
+  /**
+   * @brief Number of nodes settled by the last query.
+   * @return Number of settled nodes.
+   */
+  idx_t numSettled() const { return numSettled_; }
+
+private:
+  /**
+   * @brief Runs A* from src until dest is settled.
+   * @return true if dest is reachable from src.
+   */
+  bool search(const idx_t src, const idx_t dest);
+  /**
+   * @brief Heuristic estimate converted to the value type (rounded down for integral types).
+   */
+  val_t estimate(const idx_t node, const idx_t dest) const;
+
+  SharedGraph<Graph> graph_;              ///< @brief Searched graph
+  Heuristic heuristic_;                   ///< @brief Estimate of the remaining distance
+  SearchWorkspace<val_t> workspace_;      ///< @brief Scratch memory of the search
+  typename Graph::dest_vec_t neighbours_; ///< @brief Scratch memory for neighbour lists
+  idx_t numSettled_ = 0;                  ///< @brief Nodes settled by the last query
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+double EuclideanHeuristic::admissibleScale(const Graph& graph)
+{
+  double scale = GL_INF(double);
+  for (auto it = graph.edge_cbegin(); it != graph.edge_cend(); ++it) {
+    double length = distance(graph.getNodePosition(it->source()), graph.getNodePosition(it->dest()));
+    if (length > 0) scale = std::min(scale, double(it->weight()) / length);
+  }
+  return scale;
+}
+
+template <class Graph>
+double HaversineHeuristic::admissibleScale(const Graph& graph, const double radius)
+{
+  double scale = GL_INF(double);
+  for (auto it = graph.edge_cbegin(); it != graph.edge_cend(); ++it) {
+    double length = distance(graph.getNodePosition(it->source()), graph.getNodePosition(it->dest()), radius);
+    if (length > 0) scale = std::min(scale, double(it->weight()) / length);
+  }
+  return scale;
+}
+
+template <class Graph, class Heuristic>
+AStar<Graph,Heuristic>::AStar(const Graph& graph, const Heuristic& heuristic) : AStar(SharedGraph<Graph>::view(graph), heuristic) {}
+
+template <class Graph, class Heuristic>
+AStar<Graph,Heuristic>::AStar(Graph&& graph, const Heuristic& heuristic) : AStar(SharedGraph<Graph>(std::move(graph)), heuristic) {}
+
+template <class Graph, class Heuristic>
+AStar<Graph,Heuristic>::AStar(const SharedGraph<Graph>& graph, const Heuristic& heuristic) : graph_(graph),
+                                                                                             heuristic_(heuristic),
+                                                                                             workspace_(graph->numNodes()) {}
+
+template <class Graph, class Heuristic>
+typename Graph::val_t AStar<Graph,Heuristic>::estimate(const idx_t node, const idx_t dest) const
+{
+  double h = heuristic_(*graph_, node, dest);
+  if constexpr (std::is_integral_v<val_t>)
+    return val_t(std::floor(h));
+  else
+    return val_t(h);
+}
+
+template <class Graph, class Heuristic>
+bool AStar<Graph,Heuristic>::search(const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(graph_->numNonPositiveEdges() == 0, "AStar::search | Found non-positive edge weights in the graph.");
+  if (workspace_.size() != graph_->numNodes())
+    workspace_.resize(graph_->numNodes());
+  else
+    workspace_.reset();
+  numSettled_ = 0;
+
+  workspace_.relax(src, val_t(0), src, estimate(src, dest));
+  while (!workspace_.empty()) {
+    idx_t u = workspace_.pop().second;
+    if (workspace_.isSettled(u)) continue;
+    workspace_.settle(u);
+    ++numSettled_;
+    if (u == dest) return true;
+    val_t du = workspace_.distance(u);
+    graph_->getNeighbourWeights(u, neighbours_);
+    for (const auto& x : neighbours_) {
+      idx_t v = x.first;
+      if (workspace_.isSettled(v)) continue;
+      val_t dv = du + x.second;
+      if (!workspace_.isReached(v) || dv < workspace_.distance(v))
+        workspace_.relax(v, dv, u, dv + estimate(v, dest));
+    }
+  }
+  return false;
+}
+
+template <class Graph, class Heuristic>
+Distance<typename Graph::val_t> AStar<Graph,Heuristic>::pathLength(const idx_t src, const idx_t dest)
+{
+  graph_->checkRange(src,dest);
+  if (!search(src, dest))
+    return Distance<val_t>();
+  return Distance<val_t>(workspace_.distance(dest));
+}
+
+template <class Graph, class Heuristic>
+std::pair<bool,typename Graph::idx_list_t> AStar<Graph,Heuristic>::getPath(const idx_t src, const idx_t dest)
+{
+  graph_->checkRange(src,dest);
+  if (!search(src, dest))
+    return {false,{}};
+  return {true,workspace_.path(dest)};
+}
+
+} // namespace gl::algorithm
+
+#endif // GL_ASTAR_HPP
@@ -0,0 +1,449 @@
+#ifndef GL_BELLMAN_FORD_HPP
+#define GL_BELLMAN_FORD_HPP
+
+#include "../gl_base.hpp"
+#include "../gl_parallel.hpp"
+#include "../structures/AdjacencyArray.hpp"
+#include "../structures/SharedGraph.hpp"
+#include "../structures/ShortestPathTree.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+namespace gl::algorithm {
+
+///////////////////////////////////////////////////////////
+//    Class declaration
+///////////////////////////////////////////////////////////
+
+/**
+ * @brief Relaxation schedule of BellmanFord.
+ */
+enum class BellmanFordMode {
+  SPFA,  ///< FIFO queue of improved nodes with the small-label-first heuristic, sequential.
+  Rounds ///< Synchronous Bellman-Ford rounds over the nodes improved in the previous round, multithreaded.
+};
+
+/**
+ * In SPFA mode, improved nodes are queued, and a node whose distance is smaller than that of the queue front is
+ * queued at the front (small label first). Every node counts the edges of the walk its distance came from; once
+ * this reaches n, its predecessors are walked to look for a cycle. In Rounds mode, each round every node reached
+ * by an edge of the last round's frontier pulls its best candidate from its in-edges, in parallel.
+ * After round n, the predecessor graph is checked for a cycle. Cycles of the predecessor graph always have
+ * negative weight, and if a negative cycle is reachable, one eventually appears, so both modes detect it.
+ *
+ * Edge weights may be negative in directed graphs. Self-loops are ignored.
+ * The query interface follows Dijkstra; the result of the last source is kept until another source is queried
+ * or the graph is modified.
+ * @class BellmanFord
+ * @brief Single source shortest paths on graphs with negative weights (Bellman-Ford / SPFA).
+ */
+template <class Graph>
+class BellmanFord {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+  /**
+   * The graph is not copied, it has to outlive the BellmanFord object.
+   * @brief Initialized Constructor.
+   * @param[in] graph Graph that will be searched
+   * @param[in] mode Relaxation schedule
+   * @param[in] numThreads Number of threads used in Rounds mode, 0 for all hardware threads
+   */
+  explicit BellmanFord(const Graph& graph, const BellmanFordMode mode = BellmanFordMode::SPFA, const unsigned numThreads = 0);
+  /**
+   * @brief Initialized Constructor. Takes ownership of a temporary graph.
+   * @param[in] graph Graph that will be searched
+   * @param[in] mode Relaxation schedule
+   * @param[in] numThreads Number of threads used in Rounds mode, 0 for all hardware threads
+   */
+  explicit BellmanFord(Graph&& graph, const BellmanFordMode mode = BellmanFordMode::SPFA, const unsigned numThreads = 0);
+  /**
+   * @brief Initialized Constructor. Shares the ownership of the graph with the given handle.
+   * @param[in] graph Handle to the graph that will be searched
+   * @param[in] mode Relaxation schedule
+   * @param[in] numThreads Number of threads used in Rounds mode, 0 for all hardware threads
+   */
+  explicit BellmanFord(const SharedGraph<Graph>& graph, const BellmanFordMode mode = BellmanFordMode::SPFA, const unsigned numThreads = 0);
+
+  BellmanFord() = default;                                      ///< Default constructor
+  BellmanFord(const BellmanFord &) = default;                   ///< Copy constructor
+  BellmanFord(BellmanFord &&) noexcept = default;               ///< Move constructor
+  BellmanFord &operator=(const BellmanFord &) = default;        ///< Copy assignment
+  BellmanFord &operator=(BellmanFord &&) noexcept = default;    ///< Move assignment
+  ~BellmanFord() = default;                                     ///< Default destructor
+
+  /**
+   * @brief Computes the length of the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return Length of the shortest path, infinite if dest is unreachable.
+   */
+  Distance<val_t> pathLength(const idx_t src, const idx_t dest);
+  /**
+   * @brief Computes the node sequence that represents the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return pair of (true, path) if dest is reachable, (false, {}) otherwise.
+   */
+  std::pair<bool,idx_list_t> getPath(const idx_t src, const idx_t dest);
+  /**
+   * @brief Returns the SPT (Shortest Path Tree) starting at src as a view over the predecessor array. O(n).
+   * @param[in] src source node of the SPT.
+   * @return SPT view.
+   */
+  ShortestPathTree<Graph> getShortestPathTree(const idx_t src);
+  /**
+   * @brief Returns a graph that only contains the edges of the SPT (Shortest Path Tree) starting at src.
+   * @param[in] src source node of SPT graph.
+   * @return SPT Graph.
+   */
+  Graph getSPT(const idx_t src);
+  /**
+   * @brief Computes the distances from src to all nodes.
+   * @param[in] src Source node
+   * @param[out] distances Distance of every node from src, infinite if unreachable.
+   */
+  void queryDistances(const idx_t src, std::vector<Distance<val_t>>& distances);
+  /**
+   * @brief Computes the distances from src to all nodes and their predecessors on a shortest path tree.
+   * @param[in] src Source node
+   * @param[out] distances Distance of every node from src, infinite if unreachable.
+   * @param[out] predecessors Predecessor of every node, the node itself for src and unreachable nodes.
+   */
+  void queryDistances(const idx_t src, std::vector<Distance<val_t>>& distances, std::vector<idx_t>& predecessors);
+  /**
+   * @brief Checks whether a negative cycle is reachable from src.
+   * @param[in] src Source node
+   * @return true if there is a reachable negative cycle, false otherwise.
+   */
+  bool hasNegativeCycle(const idx_t src);
+  /**
+   * @brief Extracts a negative cycle reachable from src.
+   * @param[in] src Source node
+   * @return Nodes of the cycle in edge order, with the first node repeated at the end. Empty if there is none.
+   */
+  idx_list_t getNegativeCycle(const idx_t src);
+  /**
+   * Runs from a virtual source with 0-weight edges to all nodes, so every negative cycle of the graph is found.
+   * This is the potential step of Johnson.
+   * @brief Computes a potential h such that the reduced weights w(u,v) + h(u) - h(v) are non-negative.
+   * @param[out] potential Distance of every node from the virtual source, valid if there is no negative cycle
+   * @return (true, node on a negative cycle) or (false, 0)
+   */
+  std::pair<bool,idx_t> computePotential(std::vector<val_t>& potential);
+
+private:
+  static constexpr idx_t npos = GL_INF(idx_t); ///< @brief Marks an empty result
+
+  /**
+   * @brief Rebuilds the adjacency arrays if the graph has been modified.
+   */
+  void synchronize();
+  /**
+   * @brief Computes distances and predecessors from src, unless they are known already.
+   */
+  void compute(const idx_t src);
+  /**
+   * @brief Relaxes edges until no distance improves or a negative cycle is found.
+   * @param[in,out] distance Tentative distances, GL_INF if unreached
+   * @param[in,out] predecessor Predecessors, the node itself for roots and unreached nodes
+   * @param[in] active Nodes whose out-edges have not been relaxed yet
+   * @return A node on a negative cycle, npos if there is none.
+   */
+  idx_t run(std::vector<val_t>& distance, std::vector<idx_t>& predecessor, const std::vector<idx_t>& active) const;
+  /**
+   * @brief Walks at most n predecessors from node.
+   * @param[out] depth Number of steps to the root
+   * @return A node on a predecessor cycle, npos if the walk reaches a root.
+   */
+  static idx_t walkPredecessors(const std::vector<idx_t>& predecessor, idx_t node, idx_t& depth);
+  /**
+   * @brief Searches the whole predecessor graph for a cycle. O(n).
+   * @return A node on a predecessor cycle, npos if there is none.
+   */
+  static idx_t findPredecessorCycle(const std::vector<idx_t>& predecessor);
+  /**
+   * @brief Asserts that the object is initialized, that the nodes exist and computes the result of src.
+   */
+  void checkQuery(const char* method, const idx_t src, const idx_t dest);
+
+  SharedGraph<Graph> graph_;                    ///< @brief Searched graph
+  BellmanFordMode mode_ = BellmanFordMode::SPFA; ///< @brief Relaxation schedule
+  unsigned numThreads_ = 1;                     ///< @brief Number of threads used in Rounds mode
+  bool isSynchronized_ = false;                 ///< @brief Whether the adjacency arrays have been built
+  typename Graph::generation_t generation_ = 0; ///< @brief Generation of the graph the adjacency arrays were built from
+  AdjacencyArray<val_t> out_;                   ///< @brief Outgoing edges
+  AdjacencyArray<val_t> in_;                    ///< @brief Incoming edges, only built in Rounds mode
+  idx_t source_ = npos;                         ///< @brief Source of the stored result
+  std::vector<val_t> distance_;                 ///< @brief Distances from source_, GL_INF if unreachable
+  std::vector<idx_t> predecessor_;              ///< @brief Predecessors towards source_
+  idx_t cycleNode_ = npos;                      ///< @brief Node on a negative cycle reachable from source_, npos if there is none
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+BellmanFord<Graph>::BellmanFord(const Graph& graph, const BellmanFordMode mode, const unsigned numThreads)
+  : BellmanFord(SharedGraph<Graph>::view(graph), mode, numThreads) {}
+
+template <class Graph>
+BellmanFord<Graph>::BellmanFord(Graph&& graph, const BellmanFordMode mode, const unsigned numThreads)
+  : BellmanFord(SharedGraph<Graph>(std::move(graph)), mode, numThreads) {}
+
+template <class Graph>
+BellmanFord<Graph>::BellmanFord(const SharedGraph<Graph>& graph, const BellmanFordMode mode, const unsigned numThreads)
+  : graph_(graph), mode_(mode), numThreads_(resolveThreads(numThreads)) {}
+
+template <class Graph>
+void BellmanFord<Graph>::synchronize()
+{
+  if (isSynchronized_ && generation_ == graph_->generation()) return;
+  GL_ASSERT(graph_->isDirected() || graph_->numNegativeEdges() == 0, "BellmanFord::synchronize | Graph is undirected and contains negative weights.");
+  out_ = AdjacencyArray<val_t>(*graph_);
+  if (mode_ == BellmanFordMode::Rounds)
+    in_ = AdjacencyArray<val_t>(*graph_, true);
+  isSynchronized_ = true;
+  generation_ = graph_->generation();
+  source_ = npos;
+}
+
+template <class Graph>
+typename Graph::idx_t BellmanFord<Graph>::walkPredecessors(const std::vector<idx_t>& predecessor, idx_t node, idx_t& depth)
+{
+  // a walk of n steps that does not reach a root has entered a cycle
+  for (depth = 0; depth < predecessor.size(); ++depth) {
+    if (predecessor[node] == node) return npos;
+    node = predecessor[node];
+  }
+  return node;
+}
+
+template <class Graph>
+typename Graph::idx_t BellmanFord<Graph>::findPredecessorCycle(const std::vector<idx_t>& predecessor)
+{
+  const idx_t n = predecessor.size();
+  std::vector<idx_t> walk(n, npos);
+  for (idx_t start = 0; start < n; ++start) {
+    idx_t node = start;
+    while (walk[node] == npos && predecessor[node] != node) {
+      walk[node] = start;
+      node = predecessor[node];
+    }
+    // meeting the own walk again closes a cycle, meeting an earlier walk does not
+    if (walk[node] == start) return node;
+  }
+  return npos;
+}
+
+template <class Graph>
+typename Graph::idx_t BellmanFord<Graph>::run(std::vector<val_t>& distance, std::vector<idx_t>& predecessor, const std::vector<idx_t>& active) const
+{
+  const idx_t n = out_.numNodes();
+  if (mode_ == BellmanFordMode::SPFA) {
+    std::deque<idx_t> queue(active.begin(), active.end());
+    std::vector<char> queued(n, 0);
+    std::vector<idx_t> length(n, 0);
+    for (auto node : active)
+      queued[node] = 1;
+    while (!queue.empty()) {
+      idx_t u = queue.front();
+      queue.pop_front();
+      queued[u] = 0;
+      for (idx_t e = out_.begin(u); e < out_.end(u); ++e) {
+        idx_t v = out_.target(e);
+        val_t candidate = distance[u] + out_.weight(e);
+        if (!(candidate < distance[v])) continue;
+        distance[v] = candidate;
+        predecessor[v] = u;
+        length[v] = length[u] + 1;
+        if (length[v] >= n) {
+          // the counted walk may have been replaced since, only a cycle in the predecessors is proof
+          idx_t depth;
+          idx_t cycle = walkPredecessors(predecessor, v, depth);
+          if (cycle != npos) return cycle;
+          length[v] = depth;
+        }
+        if (queued[v]) continue;
+        queued[v] = 1;
+        if (!queue.empty() && candidate < distance[queue.front()])
+          queue.push_front(v);
+        else
+          queue.push_back(v);
+      }
+    }
+    return npos;
+  }
+
+  std::vector<idx_t> frontier(active), targets;
+  std::vector<char> inFrontier(n, 0), isTarget(n, 0);
+  std::vector<val_t> next(n);
+  std::vector<idx_t> nextPredecessor(n);
+  for (idx_t round = 1; !frontier.empty(); ++round) {
+    for (auto u : frontier)
+      inFrontier[u] = 1;
+    targets.clear();
+    for (auto u : frontier)
+      for (idx_t e = out_.begin(u); e < out_.end(u); ++e)
+        if (!isTarget[out_.target(e)]) {
+          isTarget[out_.target(e)] = 1;
+          targets.push_back(out_.target(e));
+        }
+
+    // each target only writes its own slot and reads the distances of the last round
+    const unsigned threads = targets.size() < 256 ? 1u : numThreads_;
+    parallelFor(targets.size(), threads, [&](const std::size_t i, const unsigned) {
+      idx_t v = targets[i];
+      val_t best = distance[v];
+      idx_t parent = predecessor[v];
+      for (idx_t e = in_.begin(v); e < in_.end(v); ++e) {
+        idx_t u = in_.target(e);
+        if (!inFrontier[u]) continue;
+        val_t candidate = distance[u] + in_.weight(e);
+        if (candidate < best) {
+          best = candidate;
+          parent = u;
+        }
+      }
+      next[v] = best;
+      nextPredecessor[v] = parent;
+    }, 64);
+
+    for (auto u : frontier)
+      inFrontier[u] = 0;
+    frontier.clear();
+    for (auto v : targets) {
+      isTarget[v] = 0;
+      if (next[v] < distance[v]) {
+        distance[v] = next[v];
+        predecessor[v] = nextPredecessor[v];
+        frontier.push_back(v);
+      }
+    }
+    if (round >= n && !frontier.empty()) {
+      idx_t cycle = findPredecessorCycle(predecessor);
+      if (cycle != npos) return cycle;
+    }
+  }
+  return npos;
+}
+
+template <class Graph>
+void BellmanFord<Graph>::compute(const idx_t src)
+{
+  synchronize();
+  if (source_ == src) return;
+  const idx_t n = out_.numNodes();
+  distance_.assign(n, GL_INF(val_t));
+  predecessor_.resize(n);
+  for (idx_t v = 0; v < n; ++v)
+    predecessor_[v] = v;
+  distance_[src] = val_t(0);
+  cycleNode_ = run(distance_, predecessor_, {src});
+  source_ = src;
+}
+
+template <class Graph>
+std::pair<bool,typename Graph::idx_t> BellmanFord<Graph>::computePotential(std::vector<val_t>& potential)
+{
+  GL_ASSERT(graph_,"BellmanFord::computePotential | BellmanFord has not been initialized with a graph.")
+  synchronize();
+  const idx_t n = out_.numNodes();
+  std::vector<idx_t> predecessor(n), active(n);
+  for (idx_t v = 0; v < n; ++v)
+    predecessor[v] = active[v] = v;
+  potential.assign(n, val_t(0));
+  idx_t cycle = run(potential, predecessor, active);
+  if (cycle == npos) return {false,0};
+  return {true,cycle};
+}
+
+template <class Graph>
+void BellmanFord<Graph>::checkQuery(const char* method, const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(graph_,std::string("BellmanFord::") + method + std::string(" | BellmanFord has not been initialized with a graph."))
+  graph_->checkRange(src,dest);
+  compute(src);
+  GL_ASSERT(cycleNode_ == npos,std::string("BellmanFord::") + method + std::string(" | The input graph has a negative cycle at node ")+std::to_string(cycleNode_))
+}
+
+template <class Graph>
+Distance<typename Graph::val_t> BellmanFord<Graph>::pathLength(const idx_t src, const idx_t dest)
+{
+  checkQuery("pathLength", src, dest);
+  return Distance<val_t>(distance_[dest]);
+}
+
+template <class Graph>
+std::pair<bool,typename Graph::idx_list_t> BellmanFord<Graph>::getPath(const idx_t src, const idx_t dest)
+{
+  checkQuery("getPath", src, dest);
+  if (distance_[dest] == GL_INF(val_t))
+    return {false,{}};
+  idx_list_t path {dest};
+  for (idx_t node = dest; node != src; node = predecessor_[node])
+    path.push_back(predecessor_[node]);
+  std::reverse(path.begin(), path.end());
+  return {true,path};
+}
+
+template <class Graph>
+ShortestPathTree<Graph> BellmanFord<Graph>::getShortestPathTree(const idx_t src)
+{
+  checkQuery("getShortestPathTree", src, src);
+  return ShortestPathTree<Graph>(graph_, src, predecessor_);
+}
+
+template <class Graph>
+Graph BellmanFord<Graph>::getSPT(const idx_t src)
+{
+  checkQuery("getSPT", src, src);
+  return getShortestPathTree(src).toGraph();
+}
+
+template <class Graph>
+void BellmanFord<Graph>::queryDistances(const idx_t src, std::vector<Distance<val_t>>& distances)
+{
+  std::vector<idx_t> predecessors;
+  queryDistances(src, distances, predecessors);
+}
+
+template <class Graph>
+void BellmanFord<Graph>::queryDistances(const idx_t src, std::vector<Distance<val_t>>& distances, std::vector<idx_t>& predecessors)
+{
+  checkQuery("queryDistances", src, src);
+  distances.assign(distance_.begin(), distance_.end());
+  predecessors = predecessor_;
+}
+
+template <class Graph>
+bool BellmanFord<Graph>::hasNegativeCycle(const idx_t src)
+{
+  GL_ASSERT(graph_,"BellmanFord::hasNegativeCycle | BellmanFord has not been initialized with a graph.")
+  graph_->checkRange(src);
+  compute(src);
+  return cycleNode_ != npos;
+}
+
+template <class Graph>
+typename Graph::idx_list_t BellmanFord<Graph>::getNegativeCycle(const idx_t src)
+{
+  if (!hasNegativeCycle(src))
+    return {};
+  // the predecessors run against the edge direction
+  idx_list_t cycle {cycleNode_};
+  for (idx_t node = predecessor_[cycleNode_]; node != cycleNode_; node = predecessor_[node])
+    cycle.push_back(node);
+  cycle.push_back(cycleNode_);
+  std::reverse(cycle.begin(), cycle.end());
+  return cycle;
+}
+
+} // namespace gl::algorithm
+
+#endif // GL_BELLMAN_FORD_HPP
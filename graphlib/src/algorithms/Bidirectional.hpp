@@ -0,0 +1,403 @@
+#ifndef GL_BIDIRECTIONAL_HPP
+#define GL_BIDIRECTIONAL_HPP
+
+#include "../gl_base.hpp"
+#include "../structures/AdjacencyArray.hpp"
+#include "../structures/SearchWorkspace.hpp"
+#include "../structures/SharedGraph.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace gl::algorithm {
+
+///////////////////////////////////////////////////////////
+//    Class declarations
+///////////////////////////////////////////////////////////
+
+/**
+ * A forward search from src and a backward search from dest (on the reverse graph) are advanced alternately,
+ * always on the side with the smaller queue key. The search stops once the sum of both queue keys reaches the best
+ * src-dest distance seen so far. On road-like graphs this settles far fewer nodes than a single source search.
+ * @class BidirectionalDijkstra
+ * @brief Point-to-point shortest paths with bidirectional Dijkstra.
+ */
+template <class Graph>
+class BidirectionalDijkstra {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+  /**
+   * The graph is not copied, it has to outlive the BidirectionalDijkstra object.
+   * @brief Initialized Constructor.
+   * @param[in] graph Graph that will be searched
+   */
+  explicit BidirectionalDijkstra(const Graph& graph);
+  /**
+   * @brief Initialized Constructor. Takes ownership of a temporary graph.
+   * @param[in] graph Graph that will be searched
+   */
+  explicit BidirectionalDijkstra(Graph&& graph);
+  /**
+   * @brief Initialized Constructor. Shares the ownership of the graph with the given handle.
+   * @param[in] graph Handle to the graph that will be searched
+   */
+  explicit BidirectionalDijkstra(const SharedGraph<Graph>& graph);
+
+  BidirectionalDijkstra() = default;                                                ///< Default constructor
+  BidirectionalDijkstra(const BidirectionalDijkstra &) = default;                   ///< Copy constructor
+  BidirectionalDijkstra(BidirectionalDijkstra &&) noexcept = default;               ///< Move constructor
+  BidirectionalDijkstra &operator=(const BidirectionalDijkstra &) = default;        ///< Copy assignment
+  BidirectionalDijkstra &operator=(BidirectionalDijkstra &&) noexcept = default;    ///< Move assignment
+  ~BidirectionalDijkstra() = default;                                               ///< Default destructor
+
+  /**
+   * @brief Computes the length of the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return Length of the shortest path, infinite if dest is unreachable.
+   */
+  Distance<val_t> pathLength(const idx_t src, const idx_t dest);
+  /**
+   * @brief Computes the node sequence that represents the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return pair of (true, path) if dest is reachable, (false, {}) otherwise.
+   */
+  std::pair<bool,idx_list_t> getPath(const idx_t src, const idx_t dest);
+  /**
+   * @brief Number of nodes settled by both searches of the last query.
+   * @return Number of settled nodes.
+   */
+  idx_t numSettled() const { return numSettled_; }
+
+private:
+  /**
+   * @brief Rebuilds the adjacency arrays if the graph has been modified.
+   */
+  void synchronize();
+  /**
+   * @brief Runs the bidirectional search. The result is described by found_, best_ and meet_.
+   */
+  void search(const idx_t src, const idx_t dest);
+
+  SharedGraph<Graph> graph_;                    ///< @brief Searched graph
+  typename Graph::generation_t generation_ = 0; ///< @brief Generation of the graph the adjacency arrays were built from
+  AdjacencyArray<val_t> forward_;               ///< @brief Outgoing edges
+  AdjacencyArray<val_t> backward_;              ///< @brief Incoming edges
+  SearchWorkspace<val_t> forwardSearch_;        ///< @brief Scratch memory of the search from src
+  SearchWorkspace<val_t> backwardSearch_;       ///< @brief Scratch memory of the search from dest
+  bool found_ = false;                          ///< @brief Whether the last query found a path
+  val_t best_ = 0;                              ///< @brief Length of the shortest path of the last query
+  idx_t meet_ = 0;                              ///< @brief Node where both searches met on the shortest path
+  idx_t numSettled_ = 0;                        ///< @brief Nodes settled by the last query
+};
+
+/**
+ * Breadth first searches from src and (on the reverse graph) from dest expand whole levels, always on the side with the smaller frontier.
+ * The search stops after the first level in which both searches meet.
+ * @class BidirectionalBFS
+ * @brief Point-to-point shortest paths (fewest edges) with bidirectional BFS.
+ */
+template <class Graph>
+class BidirectionalBFS {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+  /**
+   * The graph is not copied, it has to outlive the BidirectionalBFS object.
+   * @brief Initialized Constructor.
+   * @param[in] graph Graph that will be searched
+   */
+  explicit BidirectionalBFS(const Graph& graph);
+  /**
+   * @brief Initialized Constructor. Takes ownership of a temporary graph.
+   * @param[in] graph Graph that will be searched
+   */
+  explicit BidirectionalBFS(Graph&& graph);
+  /**
+   * @brief Initialized Constructor. Shares the ownership of the graph with the given handle.
+   * @param[in] graph Handle to the graph that will be searched
+   */
+  explicit BidirectionalBFS(const SharedGraph<Graph>& graph);
+
+  BidirectionalBFS() = default;                                           ///< Default constructor
+  BidirectionalBFS(const BidirectionalBFS &) = default;                   ///< Copy constructor
+  BidirectionalBFS(BidirectionalBFS &&) noexcept = default;               ///< Move constructor
+  BidirectionalBFS &operator=(const BidirectionalBFS &) = default;        ///< Copy assignment
+  BidirectionalBFS &operator=(BidirectionalBFS &&) noexcept = default;    ///< Move assignment
+  ~BidirectionalBFS() = default;                                          ///< Default destructor
+
+  /**
+   * @brief Returns the number of edges on a shortest path from src to dest.
+   * @param[in] src Start of the path
+   * @param[in] dest End of the path
+   * @return Number of edges, GL_INF(idx_t) if dest is unreachable.
+   */
+  idx_t pathLength(const idx_t src, const idx_t dest);
+  /**
+   * @brief Computes a path from src to dest with the fewest edges.
+   * @param[in] src Start of the path
+   * @param[in] dest End of the path
+   * @return pair of (true, path) if dest is reachable, (false, {}) otherwise.
+   */
+  std::pair<bool,idx_list_t> getPath(const idx_t src, const idx_t dest);
+  /**
+   * @brief Number of nodes visited by both searches of the last query.
+   * @return Number of visited nodes.
+   */
+  idx_t numVisited() const { return touched_.size(); }
+
+private:
+  /**
+   * @brief Rebuilds the adjacency arrays if the graph has been modified.
+   */
+  void synchronize();
+  /**
+   * @brief Runs the bidirectional search. The result is described by best_ and meet_.
+   */
+  void search(const idx_t src, const idx_t dest);
+  /**
+   * @brief Expands one BFS level of one side.
+   * @return true if the expanded side met the other side.
+   */
+  bool expand(const AdjacencyArray<val_t>& edges, std::vector<idx_t>& frontier, std::vector<idx_t>& distance, std::vector<idx_t>& parent, const std::vector<idx_t>& otherDistance);
+
+  SharedGraph<Graph> graph_;                    ///< @brief Searched graph
+  typename Graph::generation_t generation_ = 0; ///< @brief Generation of the graph the adjacency arrays were built from
+  AdjacencyArray<val_t> forward_;               ///< @brief Outgoing edges
+  AdjacencyArray<val_t> backward_;              ///< @brief Incoming edges
+  std::vector<idx_t> forwardDistance_;          ///< @brief Hops from src, GL_INF(idx_t) if not visited
+  std::vector<idx_t> backwardDistance_;         ///< @brief Hops to dest, GL_INF(idx_t) if not visited
+  std::vector<idx_t> forwardParent_;            ///< @brief Parent towards src
+  std::vector<idx_t> backwardParent_;           ///< @brief Parent towards dest
+  std::vector<idx_t> touched_;                  ///< @brief Nodes to clear before the next query
+  idx_t best_ = 0;                              ///< @brief Hops of the shortest path of the last query
+  idx_t meet_ = 0;                              ///< @brief Node where both searches met on the shortest path
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+BidirectionalDijkstra<Graph>::BidirectionalDijkstra(const Graph& graph) : BidirectionalDijkstra(SharedGraph<Graph>::view(graph)) {}
+
+template <class Graph>
+BidirectionalDijkstra<Graph>::BidirectionalDijkstra(Graph&& graph) : BidirectionalDijkstra(SharedGraph<Graph>(std::move(graph))) {}
+
+template <class Graph>
+BidirectionalDijkstra<Graph>::BidirectionalDijkstra(const SharedGraph<Graph>& graph) : graph_(graph),
+                                                                                       generation_(graph->generation()),
+                                                                                       forward_(*graph),
+                                                                                       backward_(*graph, graph->isDirected()),
+                                                                                       forwardSearch_(graph->numNodes()),
+                                                                                       backwardSearch_(graph->numNodes()) {}
+
+template <class Graph>
+void BidirectionalDijkstra<Graph>::synchronize()
+{
+  if (generation_ == graph_->generation()) return;
+  forward_ = AdjacencyArray<val_t>(*graph_);
+  backward_ = AdjacencyArray<val_t>(*graph_, graph_->isDirected());
+  generation_ = graph_->generation();
+  if (forwardSearch_.size() != graph_->numNodes())
+  {
+    forwardSearch_.resize(graph_->numNodes());
+    backwardSearch_.resize(graph_->numNodes());
+  }
+}
+
+template <class Graph>
+void BidirectionalDijkstra<Graph>::search(const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(graph_->numNonPositiveEdges() == 0, "BidirectionalDijkstra::search | Found non-positive edge weights in the graph.");
+  forwardSearch_.reset();
+  backwardSearch_.reset();
+  found_ = false;
+  numSettled_ = 0;
+  forwardSearch_.relax(src, val_t(0), src);
+  backwardSearch_.relax(dest, val_t(0), dest);
+
+  auto consider = [this](const idx_t node) {
+    if (!forwardSearch_.isReached(node) || !backwardSearch_.isReached(node)) return;
+    val_t candidate = forwardSearch_.distance(node) + backwardSearch_.distance(node);
+    if (!found_ || candidate < best_) {
+      found_ = true;
+      best_ = candidate;
+      meet_ = node;
+    }
+  };
+
+  while (!forwardSearch_.empty() && !backwardSearch_.empty()) {
+    if (found_ && !(forwardSearch_.top() + backwardSearch_.top() < best_)) break;
+    bool isForward = !(backwardSearch_.top() < forwardSearch_.top());
+    auto& search = isForward ? forwardSearch_ : backwardSearch_;
+    const auto& edges = isForward ? forward_ : backward_;
+
+    auto top = search.pop();
+    idx_t u = top.second;
+    if (search.isSettled(u) || search.distance(u) < top.first) continue;
+    search.settle(u);
+    ++numSettled_;
+    consider(u);
+    for (idx_t e = edges.begin(u); e < edges.end(u); ++e) {
+      idx_t v = edges.target(e);
+      search.relax(v, top.first + edges.weight(e), u);
+      consider(v);
+    }
+  }
+}
+
+template <class Graph>
+Distance<typename Graph::val_t> BidirectionalDijkstra<Graph>::pathLength(const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(graph_,"BidirectionalDijkstra::pathLength | BidirectionalDijkstra has not been initialized with a graph.")
+  graph_->checkRange(src,dest);
+  synchronize();
+  search(src, dest);
+  return found_ ? Distance<val_t>(best_) : Distance<val_t>();
+}
+
+template <class Graph>
+std::pair<bool,typename Graph::idx_list_t> BidirectionalDijkstra<Graph>::getPath(const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(graph_,"BidirectionalDijkstra::getPath | BidirectionalDijkstra has not been initialized with a graph.")
+  graph_->checkRange(src,dest);
+  synchronize();
+  search(src, dest);
+  if (!found_) return {false,{}};
+  idx_list_t out = forwardSearch_.path(meet_);
+  for (idx_t node = meet_; node != dest; ) {
+    node = backwardSearch_.predecessor(node);
+    out.push_back(node);
+  }
+  return {true,out};
+}
+
+template <class Graph>
+BidirectionalBFS<Graph>::BidirectionalBFS(const Graph& graph) : BidirectionalBFS(SharedGraph<Graph>::view(graph)) {}
+
+template <class Graph>
+BidirectionalBFS<Graph>::BidirectionalBFS(Graph&& graph) : BidirectionalBFS(SharedGraph<Graph>(std::move(graph))) {}
+
+template <class Graph>
+BidirectionalBFS<Graph>::BidirectionalBFS(const SharedGraph<Graph>& graph) : graph_(graph),
+                                                                             generation_(graph->generation()),
+                                                                             forward_(*graph),
+                                                                             backward_(*graph, graph->isDirected()),
+                                                                             forwardDistance_(graph->numNodes(), GL_INF(idx_t)),
+                                                                             backwardDistance_(graph->numNodes(), GL_INF(idx_t)),
+                                                                             forwardParent_(graph->numNodes()),
+                                                                             backwardParent_(graph->numNodes()) {}
+
+template <class Graph>
+void BidirectionalBFS<Graph>::synchronize()
+{
+  if (generation_ == graph_->generation()) return;
+  forward_ = AdjacencyArray<val_t>(*graph_);
+  backward_ = AdjacencyArray<val_t>(*graph_, graph_->isDirected());
+  generation_ = graph_->generation();
+  if (forwardDistance_.size() != graph_->numNodes())
+  {
+    forwardDistance_.assign(graph_->numNodes(), GL_INF(idx_t));
+    backwardDistance_.assign(graph_->numNodes(), GL_INF(idx_t));
+    forwardParent_.resize(graph_->numNodes());
+    backwardParent_.resize(graph_->numNodes());
+    touched_.clear();
+  }
+}
+
+template <class Graph>
+bool BidirectionalBFS<Graph>::expand(const AdjacencyArray<val_t>& edges, std::vector<idx_t>& frontier, std::vector<idx_t>& distance, std::vector<idx_t>& parent, const std::vector<idx_t>& otherDistance)
+{
+  std::vector<idx_t> next;
+  bool met = false;
+  for (auto u : frontier) {
+    for (idx_t e = edges.begin(u); e < edges.end(u); ++e) {
+      idx_t v = edges.target(e);
+      if (distance[v] == GL_INF(idx_t)) {
+        if (otherDistance[v] == GL_INF(idx_t)) touched_.push_back(v);
+        distance[v] = distance[u] + 1;
+        parent[v] = u;
+        next.push_back(v);
+      }
+      if (otherDistance[v] != GL_INF(idx_t) && distance[v] + otherDistance[v] < best_) {
+        best_ = distance[v] + otherDistance[v];
+        meet_ = v;
+        met = true;
+      }
+    }
+  }
+  frontier.swap(next);
+  return met;
+}
+
+template <class Graph>
+void BidirectionalBFS<Graph>::search(const idx_t src, const idx_t dest)
+{
+  for (auto node : touched_) {
+    forwardDistance_[node] = GL_INF(idx_t);
+    backwardDistance_[node] = GL_INF(idx_t);
+  }
+  touched_.clear();
+  best_ = GL_INF(idx_t);
+
+  forwardDistance_[src] = 0;
+  forwardParent_[src] = src;
+  backwardDistance_[dest] = 0;
+  backwardParent_[dest] = dest;
+  touched_.push_back(src);
+  touched_.push_back(dest);
+  if (src == dest) {
+    best_ = 0;
+    meet_ = src;
+    return;
+  }
+  std::vector<idx_t> forwardFrontier {src}, backwardFrontier {dest};
+  bool met = false;
+  while (!met && !forwardFrontier.empty() && !backwardFrontier.empty()) {
+    if (forwardFrontier.size() <= backwardFrontier.size())
+      met = expand(forward_, forwardFrontier, forwardDistance_, forwardParent_, backwardDistance_);
+    else
+      met = expand(backward_, backwardFrontier, backwardDistance_, backwardParent_, forwardDistance_);
+  }
+}
+
+template <class Graph>
+typename Graph::idx_t BidirectionalBFS<Graph>::pathLength(const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(graph_,"BidirectionalBFS::pathLength | BidirectionalBFS has not been initialized with a graph.")
+  graph_->checkRange(src,dest);
+  synchronize();
+  search(src, dest);
+  return best_;
+}
+
+template <class Graph>
+std::pair<bool,typename Graph::idx_list_t> BidirectionalBFS<Graph>::getPath(const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(graph_,"BidirectionalBFS::getPath | BidirectionalBFS has not been initialized with a graph.")
+  graph_->checkRange(src,dest);
+  synchronize();
+  search(src, dest);
+  if (best_ == GL_INF(idx_t)) return {false,{}};
+  idx_list_t out;
+  for (idx_t node = meet_; node != src; node = forwardParent_[node])
+    out.push_back(node);
+  out.push_back(src);
+  std::reverse(out.begin(), out.end());
+  for (idx_t node = meet_; node != dest; ) {
+    node = backwardParent_[node];
+    out.push_back(node);
+  }
+  return {true,out};
+}
+
+} // namespace gl::algorithm
+
+#endif // GL_BIDIRECTIONAL_HPP
@@ -0,0 +1,657 @@
+#ifndef GL_CONTRACTION_HIERARCHIES_HPP
+#define GL_CONTRACTION_HIERARCHIES_HPP
+
+#include "../gl_base.hpp"
+#include "../gl_parallel.hpp"
+#include "../structures/DistanceTable.hpp"
+#include "../structures/SearchWorkspace.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <vector>
+
+namespace gl::algorithm {
+
+///////////////////////////////////////////////////////////
+//    Class declaration
+///////////////////////////////////////////////////////////
+
+/**
+ * Preprocessing contracts the nodes one after another, ordered by their edge difference (shortcuts added minus edges removed)
+ * plus the number of already contracted neighbours. Contracting a node inserts a shortcut between two of its neighbours
+ * unless a bounded witness search finds a path that is at most as long without the node.
+ * The nodes are contracted in rounds: every node whose priority is smaller than the priorities of all its remaining neighbours
+ * is contracted in the current round. The witness searches and priority updates of a round run in parallel,
+ * the result does not depend on the number of threads.
+ *
+ * Queries run a bidirectional search that only follows edges to higher ranked nodes (with stall-on-demand)
+ * and unpack the shortcuts of the resulting path.
+ * The hierarchy is a snapshot: it does not observe later modifications of the graph.
+ * @class ContractionHierarchies
+ * @brief Point-to-point shortest paths with Contraction Hierarchies.
+ */
+template <class Graph>
+class ContractionHierarchies {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+  /**
+   * @brief Builds the hierarchy of a graph.
+   * @param[in] graph Graph with positive edge weights
+   * @param[in] numThreads Number of threads used by the preprocessing, 0 uses all hardware threads.
+   */
+  explicit ContractionHierarchies(const Graph& graph, unsigned numThreads = 0);
+
+  ContractionHierarchies() = default;                                                 ///< Default constructor
+  ContractionHierarchies(const ContractionHierarchies &) = default;                   ///< Copy constructor
+  ContractionHierarchies(ContractionHierarchies &&) noexcept = default;               ///< Move constructor
+  ContractionHierarchies &operator=(const ContractionHierarchies &) = default;        ///< Copy assignment
+  ContractionHierarchies &operator=(ContractionHierarchies &&) noexcept = default;    ///< Move assignment
+  ~ContractionHierarchies() = default;                                                ///< Default destructor
+
+  /**
+   * @brief Computes the length of the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return Length of the shortest path, infinite if dest is unreachable.
+   */
+  Distance<val_t> pathLength(const idx_t src, const idx_t dest);
+  /**
+   * @brief Computes the node sequence that represents the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return pair of (true, path) if dest is reachable, (false, {}) otherwise.
+   */
+  std::pair<bool,idx_list_t> getPath(const idx_t src, const idx_t dest);
+  /**
+   * Bucket based many-to-many: one upward search per distinct target stores (target, distance) entries in buckets
+   * at the nodes it settles, then one upward search per distinct source only scans the buckets of the nodes it settles.
+   * Both phases run in parallel.
+   * @brief Computes the shortest path lengths from every source to every target.
+   * @param[in] sources Row nodes, may contain duplicates
+   * @param[in] targets Column nodes, may contain duplicates
+   * @param[in] numThreads Number of threads, 0 uses all hardware threads.
+   * @return Table of distances, infinite for unreachable targets.
+   */
+  DistanceTable<val_t> distanceTable(const idx_list_t& sources, const idx_list_t& targets, unsigned numThreads = 0) const;
+  /**
+   * @brief Number of nodes settled (in both directions) by the last query.
+   * @return Number of settled nodes.
+   */
+  idx_t numSettled() const { return numSettled_; }
+  /**
+   * @brief Number of nodes of the preprocessed graph.
+   * @return Number of nodes.
+   */
+  idx_t numNodes() const { return rank_.size(); }
+  /**
+   * @brief Number of shortcuts inserted by the preprocessing.
+   * @return Number of shortcuts.
+   */
+  idx_t numShortcuts() const;
+  /**
+   * @brief Position of a node in the contraction order.
+   * @param[in] node Node ID
+   * @return 0 for the node contracted first, numNodes()-1 for the node contracted last.
+   */
+  idx_t rank(const idx_t node) const { return rank_[node]; }
+  /**
+   * The format is binary and specific to the index and value types of the graph.
+   * @brief Writes the hierarchy to a file.
+   * @param[in] filename Output file
+   */
+  void save(const std::string& filename) const;
+  /**
+   * @brief Replaces the hierarchy with one written by save().
+   * @param[in] filename Input file
+   */
+  void load(const std::string& filename);
+
+private:
+  /**
+   * @brief Edges of the search graph in compressed rows.
+   */
+  struct Overlay {
+    std::vector<idx_t> offsets; ///< @brief Edges of node u are [offsets[u], offsets[u+1])
+    std::vector<idx_t> targets; ///< @brief Other end of the edge
+    std::vector<val_t> weights; ///< @brief Edge weights
+    std::vector<idx_t> middles; ///< @brief Contracted node bridged by a shortcut, noMiddle for original edges
+  };
+  /**
+   * @brief Edge of the partially contracted graph.
+   */
+  struct Arc {
+    idx_t node;   ///< @brief Other end of the edge
+    val_t weight; ///< @brief Edge weight
+    idx_t middle; ///< @brief Contracted node bridged by a shortcut, noMiddle for original edges
+  };
+  /**
+   * @brief Shortcut found while contracting a node.
+   */
+  struct Shortcut {
+    idx_t source; ///< @brief Start of the shortcut
+    idx_t dest;   ///< @brief End of the shortcut
+    val_t weight; ///< @brief Length of the bridged path
+  };
+  /**
+   * @brief Working state of the preprocessing.
+   */
+  struct Contraction {
+    std::vector<std::vector<Arc>> out;            ///< @brief Outgoing edges between remaining nodes
+    std::vector<std::vector<Arc>> in;             ///< @brief Incoming edges between remaining nodes
+    std::vector<long long> priority;              ///< @brief Contraction priority of the remaining nodes
+    std::vector<idx_t> deleted;                   ///< @brief Number of contracted neighbours
+    std::vector<char> excluded;                   ///< @brief Nodes contracted in the current round
+    std::vector<SearchWorkspace<val_t>> witness;  ///< @brief Witness search workspace per thread
+  };
+
+  static constexpr idx_t noMiddle = GL_INF(idx_t); ///< @brief Marks original edges
+  static constexpr idx_t witnessLimit = 500;       ///< @brief Maximum number of nodes settled by a witness search
+
+  /**
+   * @brief Contracts all nodes and builds the overlays.
+   */
+  void build(const Graph& graph, unsigned numThreads);
+  /**
+   * @brief Inserts the edge source->dest or lowers its weight.
+   */
+  static void addArc(Contraction& state, const idx_t source, const idx_t dest, const val_t weight, const idx_t middle);
+  /**
+   * @brief Computes the shortcuts needed to contract a node, skipping the nodes excluded in this round.
+   */
+  static void findShortcuts(const Contraction& state, const idx_t node, SearchWorkspace<val_t>& workspace, std::vector<Shortcut>& out);
+  /**
+   * @brief Edge difference plus the number of contracted neighbours.
+   */
+  static long long computePriority(const Contraction& state, const idx_t node, SearchWorkspace<val_t>& workspace);
+  /**
+   * @brief Checks whether a node has a smaller priority than all its remaining neighbours.
+   */
+  static bool isLocalMinimum(const Contraction& state, const idx_t node);
+  /**
+   * @brief Converts the per node edge lists into compressed rows.
+   */
+  static Overlay compress(std::vector<std::vector<Arc>>& arcs);
+  /**
+   * @brief Runs the upward search from src and dest.
+   * @return true if dest is reachable from src.
+   */
+  bool search(const idx_t src, const idx_t dest);
+  /**
+   * @brief Runs a complete upward search from src with stall-on-demand and calls visit(node, distance) for every settled, unstalled node.
+   */
+  template <class Visit>
+  void upwardSearch(const idx_t src, const bool isForward, SearchWorkspace<val_t>& workspace, const Visit& visit) const;
+  /**
+   * @brief Appends the original path represented by the edge source->dest, without source.
+   */
+  void unpack(const idx_t source, const idx_t dest, idx_list_t& out) const;
+
+  std::vector<idx_t> rank_;          ///< @brief Contraction order
+  Overlay up_;                       ///< @brief Edges u->v with rank(u) < rank(v), stored at u
+  Overlay down_;                     ///< @brief Edges v->u with rank(u) < rank(v), stored at u
+  SearchWorkspace<val_t> forward_;   ///< @brief Scratch memory of the forward search
+  SearchWorkspace<val_t> backward_;  ///< @brief Scratch memory of the backward search
+  idx_t meeting_ = 0;                ///< @brief Highest node of the last found path
+  val_t best_ = 0;                   ///< @brief Length of the last found path
+  idx_t numSettled_ = 0;             ///< @brief Nodes settled by the last query
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+ContractionHierarchies<Graph>::ContractionHierarchies(const Graph& graph, unsigned numThreads)
+{
+  build(graph, resolveThreads(numThreads));
+}
+
+template <class Graph>
+void ContractionHierarchies<Graph>::addArc(Contraction& state, const idx_t source, const idx_t dest, const val_t weight, const idx_t middle)
+{
+  for (auto& arc : state.out[source]) {
+    if (arc.node != dest) continue;
+    if (weight < arc.weight) {
+      arc.weight = weight;
+      arc.middle = middle;
+      for (auto& back : state.in[dest])
+        if (back.node == source) { back.weight = weight; back.middle = middle; }
+    }
+    return;
+  }
+  state.out[source].push_back({dest, weight, middle});
+  state.in[dest].push_back({source, weight, middle});
+}
+
+template <class Graph>
+void ContractionHierarchies<Graph>::findShortcuts(const Contraction& state, const idx_t node, SearchWorkspace<val_t>& workspace, std::vector<Shortcut>& out)
+{
+  out.clear();
+  for (const auto& first : state.in[node]) {
+    bool hasTarget = false;
+    val_t limit = 0;
+    for (const auto& second : state.out[node]) {
+      if (second.node == first.node) continue;
+      limit = hasTarget ? std::max(limit, first.weight + second.weight) : first.weight + second.weight;
+      hasTarget = true;
+    }
+    if (!hasTarget) continue;
+
+    // bounded Dijkstra from the in-neighbour that avoids the contracted node
+    workspace.reset();
+    workspace.relax(first.node, val_t(0), first.node);
+    idx_t settled = 0;
+    while (!workspace.empty() && settled < witnessLimit) {
+      auto top = workspace.pop();
+      idx_t u = top.second;
+      if (workspace.isSettled(u)) continue;
+      if (limit < top.first) break;
+      workspace.settle(u);
+      ++settled;
+      for (const auto& arc : state.out[u])
+        if (arc.node != node && !state.excluded[arc.node])
+          workspace.relax(arc.node, top.first + arc.weight, u);
+    }
+
+    for (const auto& second : state.out[node]) {
+      if (second.node == first.node) continue;
+      val_t weight = first.weight + second.weight;
+      if (!workspace.isReached(second.node) || weight < workspace.distance(second.node))
+        out.push_back({first.node, second.node, weight});
+    }
+  }
+}
+
+template <class Graph>
+long long ContractionHierarchies<Graph>::computePriority(const Contraction& state, const idx_t node, SearchWorkspace<val_t>& workspace)
+{
+  std::vector<Shortcut> shortcuts;
+  findShortcuts(state, node, workspace, shortcuts);
+  return (long long)(shortcuts.size()) - (long long)(state.in[node].size() + state.out[node].size()) + (long long)(state.deleted[node]);
+}
+
+template <class Graph>
+bool ContractionHierarchies<Graph>::isLocalMinimum(const Contraction& state, const idx_t node)
+{
+  auto key = std::make_pair(state.priority[node], node);
+  for (const auto* arcs : {&state.out[node], &state.in[node]})
+    for (const auto& arc : *arcs)
+      if (std::make_pair(state.priority[arc.node], arc.node) < key)
+        return false;
+  return true;
+}
+
+template <class Graph>
+typename ContractionHierarchies<Graph>::Overlay ContractionHierarchies<Graph>::compress(std::vector<std::vector<Arc>>& arcs)
+{
+  Overlay overlay;
+  overlay.offsets.reserve(arcs.size() + 1);
+  overlay.offsets.push_back(0);
+  for (auto& list : arcs) {
+    std::sort(list.begin(), list.end(), [](const Arc& lhs, const Arc& rhs) { return lhs.node < rhs.node; });
+    for (const auto& arc : list) {
+      overlay.targets.push_back(arc.node);
+      overlay.weights.push_back(arc.weight);
+      overlay.middles.push_back(arc.middle);
+    }
+    overlay.offsets.push_back(overlay.targets.size());
+    std::vector<Arc>().swap(list);
+  }
+  return overlay;
+}
+
+template <class Graph>
+void ContractionHierarchies<Graph>::build(const Graph& graph, unsigned numThreads)
+{
+  GL_ASSERT(graph.numNonPositiveEdges() == 0, "ContractionHierarchies::build | Found non-positive edge weights in the graph.");
+  const idx_t n = graph.numNodes();
+  Contraction state;
+  state.out.resize(n);
+  state.in.resize(n);
+  state.priority.assign(n, 0);
+  state.deleted.assign(n, 0);
+  state.excluded.assign(n, 0);
+  state.witness.assign(numThreads, SearchWorkspace<val_t>(n));
+
+  typename Graph::dest_vec_t neighbours;
+  for (idx_t u = 0; u < n; ++u) {
+    graph.getNeighbourWeights(u, neighbours);
+    for (const auto& x : neighbours)
+      if (x.first != u)
+        addArc(state, u, x.first, x.second, noMiddle);
+  }
+
+  std::vector<idx_t> remaining(n);
+  for (idx_t u = 0; u < n; ++u)
+    remaining[u] = u;
+  parallelFor(n, numThreads, [&](idx_t i, unsigned thread) {
+    state.priority[i] = computePriority(state, i, state.witness[thread]);
+  });
+
+  rank_.assign(n, 0);
+  std::vector<std::vector<Arc>> upArcs(n), downArcs(n);
+  std::vector<idx_t> round, touched;
+  std::vector<std::vector<Shortcut>> shortcuts;
+  idx_t nextRank = 0;
+  while (!remaining.empty()) {
+    round.clear();
+    for (auto u : remaining)
+      if (isLocalMinimum(state, u))
+        round.push_back(u);
+    for (auto u : round)
+      state.excluded[u] = 1;
+
+    shortcuts.resize(round.size());
+    parallelFor(round.size(), numThreads, [&](idx_t i, unsigned thread) {
+      findShortcuts(state, round[i], state.witness[thread], shortcuts[i]);
+    });
+
+    touched.clear();
+    for (idx_t i = 0; i < round.size(); ++i) {
+      idx_t v = round[i];
+      rank_[v] = nextRank++;
+      for (const auto& arc : state.out[v]) {
+        auto& back = state.in[arc.node];
+        back.erase(std::find_if(back.begin(), back.end(), [v](const Arc& a) { return a.node == v; }));
+        ++state.deleted[arc.node];
+        touched.push_back(arc.node);
+      }
+      for (const auto& arc : state.in[v]) {
+        auto& back = state.out[arc.node];
+        back.erase(std::find_if(back.begin(), back.end(), [v](const Arc& a) { return a.node == v; }));
+        ++state.deleted[arc.node];
+        touched.push_back(arc.node);
+      }
+      upArcs[v] = std::move(state.out[v]);
+      downArcs[v] = std::move(state.in[v]);
+      state.out[v].clear();
+      state.in[v].clear();
+      for (const auto& s : shortcuts[i])
+        addArc(state, s.source, s.dest, s.weight, v);
+    }
+
+    remaining.erase(std::remove_if(remaining.begin(), remaining.end(), [&](idx_t u) { return state.excluded[u] != 0; }), remaining.end());
+    std::sort(touched.begin(), touched.end());
+    touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+    parallelFor(touched.size(), numThreads, [&](idx_t i, unsigned thread) {
+      state.priority[touched[i]] = computePriority(state, touched[i], state.witness[thread]);
+    });
+  }
+
+  up_ = compress(upArcs);
+  down_ = compress(downArcs);
+  forward_.resize(n);
+  backward_.resize(n);
+}
+
+template <class Graph>
+typename ContractionHierarchies<Graph>::idx_t ContractionHierarchies<Graph>::numShortcuts() const
+{
+  idx_t count = 0;
+  for (const auto* overlay : {&up_, &down_})
+    count += std::count_if(overlay->middles.begin(), overlay->middles.end(), [](idx_t m) { return m != noMiddle; });
+  return count;
+}
+
+template <class Graph>
+bool ContractionHierarchies<Graph>::search(const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(src < numNodes() && dest < numNodes(), "ContractionHierarchies::search | Node index out of range.");
+  forward_.reset();
+  backward_.reset();
+  numSettled_ = 0;
+  bool found = false;
+  forward_.relax(src, val_t(0), src);
+  backward_.relax(dest, val_t(0), dest);
+
+  while (!forward_.empty() || !backward_.empty()) {
+    bool isForward = backward_.empty() || (!forward_.empty() && !(backward_.top() < forward_.top()));
+    auto& workspace = isForward ? forward_ : backward_;
+    auto& other = isForward ? backward_ : forward_;
+    const Overlay& edges = isForward ? up_ : down_;
+    const Overlay& stall = isForward ? down_ : up_;
+    if (found && !(workspace.top() < best_)) break;
+
+    auto top = workspace.pop();
+    idx_t u = top.second;
+    if (workspace.isSettled(u)) continue;
+    workspace.settle(u);
+    ++numSettled_;
+    if (other.isReached(u) && (!found || top.first + other.distance(u) < best_)) {
+      best_ = top.first + other.distance(u);
+      meeting_ = u;
+      found = true;
+    }
+
+    // stall-on-demand: u is not reached on a shortest upward path if a higher node offers a shorter way to it
+    bool stalled = false;
+    for (idx_t e = stall.offsets[u]; e < stall.offsets[u+1] && !stalled; ++e)
+      stalled = workspace.isReached(stall.targets[e]) && workspace.distance(stall.targets[e]) + stall.weights[e] < top.first;
+    if (stalled) continue;
+
+    for (idx_t e = edges.offsets[u]; e < edges.offsets[u+1]; ++e)
+      workspace.relax(edges.targets[e], top.first + edges.weights[e], u);
+  }
+  return found;
+}
+
+template <class Graph>
+void ContractionHierarchies<Graph>::unpack(const idx_t source, const idx_t dest, idx_list_t& out) const
+{
+  std::vector<std::pair<idx_t,idx_t>> stack {{source, dest}};
+  while (!stack.empty()) {
+    auto [u, v] = stack.back();
+    stack.pop_back();
+    // an edge is stored at its lower ranked end
+    const Overlay& overlay = rank_[u] < rank_[v] ? up_ : down_;
+    idx_t low = rank_[u] < rank_[v] ? u : v, high = rank_[u] < rank_[v] ? v : u;
+    auto begin = overlay.targets.begin() + overlay.offsets[low], end = overlay.targets.begin() + overlay.offsets[low+1];
+    auto it = std::lower_bound(begin, end, high);
+    GL_ASSERT(it != end && *it == high, "ContractionHierarchies::unpack | Edge is missing in the hierarchy.");
+    idx_t middle = overlay.middles[it - overlay.targets.begin()];
+    if (middle == noMiddle) {
+      out.push_back(v);
+    } else {
+      stack.emplace_back(middle, v);
+      stack.emplace_back(u, middle);
+    }
+  }
+}
+
+template <class Graph>
+Distance<typename Graph::val_t> ContractionHierarchies<Graph>::pathLength(const idx_t src, const idx_t dest)
+{
+  if (!search(src, dest))
+    return Distance<val_t>();
+  return Distance<val_t>(best_);
+}
+
+template <class Graph>
+std::pair<bool,typename Graph::idx_list_t> ContractionHierarchies<Graph>::getPath(const idx_t src, const idx_t dest)
+{
+  if (!search(src, dest))
+    return {false,{}};
+  idx_list_t upward = forward_.path(meeting_);
+  idx_list_t downward = backward_.path(meeting_);
+  std::reverse(downward.begin(), downward.end());
+  upward.insert(upward.end(), downward.begin() + 1, downward.end());
+
+  idx_list_t path {src};
+  for (idx_t i = 1; i < upward.size(); ++i)
+    unpack(upward[i-1], upward[i], path);
+  return {true,path};
+}
+
+template <class Graph>
+template <class Visit>
+void ContractionHierarchies<Graph>::upwardSearch(const idx_t src, const bool isForward, SearchWorkspace<val_t>& workspace, const Visit& visit) const
+{
+  const Overlay& edges = isForward ? up_ : down_;
+  const Overlay& stall = isForward ? down_ : up_;
+  if (workspace.size() != numNodes()) workspace.resize(numNodes());
+  else workspace.reset();
+  workspace.relax(src, val_t(0), src);
+  while (!workspace.empty()) {
+    auto top = workspace.pop();
+    idx_t u = top.second;
+    if (workspace.isSettled(u)) continue;
+    workspace.settle(u);
+
+    bool stalled = false;
+    for (idx_t e = stall.offsets[u]; e < stall.offsets[u+1] && !stalled; ++e)
+      stalled = workspace.isReached(stall.targets[e]) && workspace.distance(stall.targets[e]) + stall.weights[e] < top.first;
+    if (stalled) continue;
+    visit(u, top.first);
+
+    for (idx_t e = edges.offsets[u]; e < edges.offsets[u+1]; ++e)
+      workspace.relax(edges.targets[e], top.first + edges.weights[e], u);
+  }
+}
+
+template <class Graph>
+DistanceTable<typename Graph::val_t> ContractionHierarchies<Graph>::distanceTable(const idx_list_t& sources, const idx_list_t& targets, unsigned numThreads) const
+{
+  const idx_t n = numNodes();
+  for (auto node : sources)
+    GL_ASSERT(node < n, "ContractionHierarchies::distanceTable | Node index out of range.");
+  for (auto node : targets)
+    GL_ASSERT(node < n, "ContractionHierarchies::distanceTable | Node index out of range.");
+  numThreads = resolveThreads(numThreads);
+
+  idx_list_t uniqueSources(sources), uniqueTargets(targets);
+  std::sort(uniqueSources.begin(), uniqueSources.end());
+  uniqueSources.erase(std::unique(uniqueSources.begin(), uniqueSources.end()), uniqueSources.end());
+  std::sort(uniqueTargets.begin(), uniqueTargets.end());
+  uniqueTargets.erase(std::unique(uniqueTargets.begin(), uniqueTargets.end()), uniqueTargets.end());
+  const idx_t numUnique = uniqueTargets.size();
+  std::vector<SearchWorkspace<val_t>> workspaces(numThreads);
+
+  // backward phase: every thread collects (node, target slot, distance) entries, which are then sorted into buckets by node
+  struct Entry {
+    idx_t node;   ///< @brief Settled node
+    idx_t slot;   ///< @brief Index of the target in uniqueTargets
+    val_t weight; ///< @brief Distance from the node to the target
+  };
+  std::vector<std::vector<Entry>> entries(numThreads);
+  parallelFor(numUnique, numThreads, [&](const std::size_t j, const unsigned thread) {
+    upwardSearch(uniqueTargets[j], false, workspaces[thread], [&](const idx_t u, const val_t d) {
+      entries[thread].push_back({u, idx_t(j), d});
+    });
+  }, 1);
+  std::vector<idx_t> bucketOffsets(n + 1, 0);
+  for (const auto& list : entries)
+    for (const auto& entry : list)
+      ++bucketOffsets[entry.node + 1];
+  for (idx_t u = 0; u < n; ++u)
+    bucketOffsets[u + 1] += bucketOffsets[u];
+  std::vector<std::pair<idx_t,val_t>> buckets(bucketOffsets[n]);
+  std::vector<idx_t> next(bucketOffsets.begin(), bucketOffsets.end() - 1);
+  for (auto& list : entries) {
+    for (const auto& entry : list)
+      buckets[next[entry.node]++] = {entry.slot, entry.weight};
+    std::vector<Entry>().swap(list);
+  }
+
+  // forward phase: the buckets of the settled nodes hold all candidate meeting points
+  std::vector<val_t> rows(uniqueSources.size() * numUnique, GL_INF(val_t));
+  std::vector<char> found(rows.size(), 0);
+  parallelFor(uniqueSources.size(), numThreads, [&](const std::size_t i, const unsigned thread) {
+    val_t* row = rows.data() + i * numUnique;
+    char* reached = found.data() + i * numUnique;
+    upwardSearch(uniqueSources[i], true, workspaces[thread], [&](const idx_t u, const val_t d) {
+      for (idx_t b = bucketOffsets[u]; b < bucketOffsets[u+1]; ++b) {
+        val_t candidate = d + buckets[b].second;
+        if (!reached[buckets[b].first] || candidate < row[buckets[b].first]) {
+          row[buckets[b].first] = candidate;
+          reached[buckets[b].first] = 1;
+        }
+      }
+    });
+  }, 1);
+
+  DistanceTable<val_t> table(sources, targets);
+  for (idx_t i = 0; i < sources.size(); ++i) {
+    idx_t row = std::lower_bound(uniqueSources.begin(), uniqueSources.end(), sources[i]) - uniqueSources.begin();
+    for (idx_t j = 0; j < targets.size(); ++j) {
+      idx_t column = std::lower_bound(uniqueTargets.begin(), uniqueTargets.end(), targets[j]) - uniqueTargets.begin();
+      if (found[row * numUnique + column])
+        table(i, j) = Distance<val_t>(rows[row * numUnique + column]);
+    }
+  }
+  return table;
+}
+
+template <class Graph>
+void ContractionHierarchies<Graph>::save(const std::string& filename) const
+{
+  std::ofstream os(filename, std::ios::binary);
+  GL_ASSERT(os.is_open(), std::string("ContractionHierarchies::save | Failed to open ") + filename);
+  auto writeValue = [&os](auto value) { os.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+  auto writeVector = [&](const auto& vec) {
+    writeValue(std::uint64_t(vec.size()));
+    os.write(reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(vec[0]));
+  };
+  os.write("GLCH", 4);
+  writeValue(std::uint32_t(1));
+  writeValue(std::uint32_t(sizeof(idx_t)));
+  writeValue(std::uint32_t(sizeof(val_t)));
+  writeValue(std::uint32_t(std::is_integral_v<val_t>));
+  writeVector(rank_);
+  for (const auto* overlay : {&up_, &down_}) {
+    writeVector(overlay->offsets);
+    writeVector(overlay->targets);
+    writeVector(overlay->weights);
+    writeVector(overlay->middles);
+  }
+  GL_ASSERT(os.good(), std::string("ContractionHierarchies::save | Failed to write ") + filename);
+}
+
+template <class Graph>
+void ContractionHierarchies<Graph>::load(const std::string& filename)
+{
+  std::ifstream is(filename, std::ios::binary);
+  GL_ASSERT(is.is_open(), std::string("ContractionHierarchies::load | Failed to open ") + filename);
+  auto readValue = [&is](auto& value) { is.read(reinterpret_cast<char*>(&value), sizeof(value)); };
+  auto readVector = [&](auto& vec) {
+    std::uint64_t size = 0;
+    readValue(size);
+    GL_ASSERT(is.good(), std::string("ContractionHierarchies::load | Truncated file ") + filename);
+    vec.resize(size);
+    is.read(reinterpret_cast<char*>(vec.data()), size * sizeof(vec[0]));
+  };
+  char magic[4] = {};
+  std::uint32_t version = 0, idxSize = 0, valSize = 0, integral = 0;
+  is.read(magic, 4);
+  readValue(version);
+  readValue(idxSize);
+  readValue(valSize);
+  readValue(integral);
+  GL_ASSERT(is.good() && std::memcmp(magic, "GLCH", 4) == 0 && version == 1,
+            std::string("ContractionHierarchies::load | Not a contraction hierarchy file: ") + filename);
+  GL_ASSERT(idxSize == sizeof(idx_t) && valSize == sizeof(val_t) && integral == std::uint32_t(std::is_integral_v<val_t>),
+            std::string("ContractionHierarchies::load | Value types do not match the file ") + filename);
+  ContractionHierarchies loaded;
+  readVector(loaded.rank_);
+  for (auto* overlay : {&loaded.up_, &loaded.down_}) {
+    readVector(overlay->offsets);
+    readVector(overlay->targets);
+    readVector(overlay->weights);
+    readVector(overlay->middles);
+  }
+  GL_ASSERT(is.good(), std::string("ContractionHierarchies::load | Truncated file ") + filename);
+  GL_ASSERT(loaded.up_.offsets.size() == loaded.numNodes() + 1 && loaded.down_.offsets.size() == loaded.numNodes() + 1,
+            std::string("ContractionHierarchies::load | Inconsistent file ") + filename);
+  loaded.forward_.resize(loaded.numNodes());
+  loaded.backward_.resize(loaded.numNodes());
+  *this = std::move(loaded);
+}
+
+} // namespace gl::algorithm
+
+#endif // GL_CONTRACTION_HIERARCHIES_HPP
@@ -0,0 +1,337 @@
+#ifndef GL_DELTA_STEPPING_HPP
+#define GL_DELTA_STEPPING_HPP
+
+#include "../gl_base.hpp"
+#include "../gl_parallel.hpp"
+#include "../structures/AdjacencyArray.hpp"
+#include "../structures/SharedGraph.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace gl::algorithm {
+
+///////////////////////////////////////////////////////////
+//    Class declaration
+///////////////////////////////////////////////////////////
+
+/**
+ * Tentative distances are grouped into buckets of width delta. The smallest non-empty bucket is processed in phases:
+ * all its nodes relax their light edges (weight <= delta) in parallel, which may refill the bucket, until it stays empty.
+ * Then the heavy edges of all nodes removed from the bucket are relaxed in parallel. Relaxations are atomic min-updates
+ * on a flat distance array, so the distances are exactly those of Dijkstra; only the predecessors of ties may differ.
+ *
+ * The default delta is the largest edge weight divided by the average degree. Small frontiers are processed
+ * on the calling thread, since starting threads would cost more than the relaxations.
+ * The query interface follows Dijkstra; the result of the last source is kept until another source is queried
+ * or the graph is modified.
+ * @class DeltaStepping
+ * @brief Multithreaded single source shortest paths with delta-stepping.
+ */
+template <class Graph>
+class DeltaStepping {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+  /**
+   * The graph is not copied, it has to outlive the DeltaStepping object.
+   * @brief Initialized Constructor.
+   * @param[in] graph Graph that will be searched
+   * @param[in] numThreads Number of threads, 0 for all hardware threads
+   * @param[in] delta Bucket width, 0 to choose it from the graph
+   */
+  explicit DeltaStepping(const Graph& graph, const unsigned numThreads = 0, const val_t delta = 0);
+  /**
+   * @brief Initialized Constructor. Takes ownership of a temporary graph.
+   * @param[in] graph Graph that will be searched
+   * @param[in] numThreads Number of threads, 0 for all hardware threads
+   * @param[in] delta Bucket width, 0 to choose it from the graph
+   */
+  explicit DeltaStepping(Graph&& graph, const unsigned numThreads = 0, const val_t delta = 0);
+  /**
+   * @brief Initialized Constructor. Shares the ownership of the graph with the given handle.
+   * @param[in] graph Handle to the graph that will be searched
+   * @param[in] numThreads Number of threads, 0 for all hardware threads
+   * @param[in] delta Bucket width, 0 to choose it from the graph
+   */
+  explicit DeltaStepping(const SharedGraph<Graph>& graph, const unsigned numThreads = 0, const val_t delta = 0);
+
+  DeltaStepping() = default;                                        ///< Default constructor
+  DeltaStepping(const DeltaStepping &) = default;                   ///< Copy constructor
+  DeltaStepping(DeltaStepping &&) noexcept = default;               ///< Move constructor
+  DeltaStepping &operator=(const DeltaStepping &) = default;        ///< Copy assignment
+  DeltaStepping &operator=(DeltaStepping &&) noexcept = default;    ///< Move assignment
+  ~DeltaStepping() = default;                                       ///< Default destructor
+
+  /**
+   * @brief Computes the length of the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return Length of the shortest path, infinite if dest is unreachable.
+   */
+  Distance<val_t> pathLength(const idx_t src, const idx_t dest);
+  /**
+   * @brief Computes the node sequence that represents the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return pair of (true, path) if dest is reachable, (false, {}) otherwise.
+   */
+  std::pair<bool,idx_list_t> getPath(const idx_t src, const idx_t dest);
+  /**
+   * @brief Computes the distances from src to all nodes.
+   * @param[in] src Source node
+   * @param[out] distances Distance of every node from src, infinite if unreachable.
+   */
+  void queryDistances(const idx_t src, std::vector<Distance<val_t>>& distances);
+  /**
+   * @brief Computes the distances from src to all nodes and their predecessors on a shortest path tree.
+   * @param[in] src Source node
+   * @param[out] distances Distance of every node from src, infinite if unreachable.
+   * @param[out] predecessors Predecessor of every node, the node itself for src and unreachable nodes.
+   */
+  void queryDistances(const idx_t src, std::vector<Distance<val_t>>& distances, std::vector<idx_t>& predecessors);
+  /**
+   * @brief Bucket width used for the current graph.
+   * @return delta
+   */
+  val_t delta();
+
+private:
+  static constexpr idx_t npos = GL_INF(idx_t); ///< @brief Marks an empty result
+
+  /**
+   * @brief Rebuilds the light/heavy adjacency arrays and delta if the graph has been modified.
+   */
+  void synchronize();
+  /**
+   * @brief Computes distances and predecessors from src, unless they are known already.
+   */
+  void compute(const idx_t src);
+
+  SharedGraph<Graph> graph_;                    ///< @brief Searched graph
+  unsigned numThreads_ = 1;                     ///< @brief Number of threads
+  val_t requestedDelta_ = 0;                    ///< @brief Bucket width requested by the user, 0 for automatic
+  bool isSynchronized_ = false;                 ///< @brief Whether the adjacency arrays have been built
+  typename Graph::generation_t generation_ = 0; ///< @brief Generation of the graph the adjacency arrays were built from
+  val_t delta_ = 1;                             ///< @brief Bucket width
+  val_t maxWeight_ = 0;                         ///< @brief Largest edge weight
+  std::vector<idx_t> offsets_;                  ///< @brief Edges of node u are [offsets_[u], offsets_[u+1])
+  std::vector<idx_t> lightEnd_;                 ///< @brief Light edges of node u are [offsets_[u], lightEnd_[u])
+  std::vector<idx_t> targets_;                  ///< @brief Edge endpoints
+  std::vector<val_t> weights_;                  ///< @brief Edge weights
+  idx_t source_ = npos;                         ///< @brief Source of the stored result
+  std::vector<val_t> distance_;                 ///< @brief Distances from source_, GL_INF if unreachable
+  std::vector<idx_t> predecessor_;              ///< @brief Predecessors towards source_
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+DeltaStepping<Graph>::DeltaStepping(const Graph& graph, const unsigned numThreads, const val_t delta)
+  : DeltaStepping(SharedGraph<Graph>::view(graph), numThreads, delta) {}
+
+template <class Graph>
+DeltaStepping<Graph>::DeltaStepping(Graph&& graph, const unsigned numThreads, const val_t delta)
+  : DeltaStepping(SharedGraph<Graph>(std::move(graph)), numThreads, delta) {}
+
+template <class Graph>
+DeltaStepping<Graph>::DeltaStepping(const SharedGraph<Graph>& graph, const unsigned numThreads, const val_t delta)
+  : graph_(graph), numThreads_(resolveThreads(numThreads)), requestedDelta_(delta)
+{
+  GL_ASSERT(!(delta < val_t(0)), "DeltaStepping::DeltaStepping | The bucket width must not be negative.");
+}
+
+template <class Graph>
+void DeltaStepping<Graph>::synchronize()
+{
+  if (isSynchronized_ && generation_ == graph_->generation()) return;
+  GL_ASSERT(graph_->numNonPositiveEdges() == 0, "DeltaStepping::synchronize | Found non-positive edge weights in the graph.");
+  AdjacencyArray<val_t> edges(*graph_);
+  const idx_t n = edges.numNodes();
+
+  maxWeight_ = 0;
+  for (idx_t e = 0; e < edges.numEdges(); ++e)
+    maxWeight_ = std::max(maxWeight_, edges.weight(e));
+  if (requestedDelta_ > val_t(0)) {
+    delta_ = requestedDelta_;
+  } else {
+    // on average, one light edge per node
+    double averageDegree = n == 0 ? 1. : std::max(1., double(edges.numEdges()) / n);
+    delta_ = val_t(double(maxWeight_) / averageDegree);
+    if (!(delta_ > val_t(0))) delta_ = maxWeight_ > val_t(0) ? maxWeight_ : val_t(1);
+  }
+
+  // light edges first
+  offsets_.assign(n + 1, 0);
+  lightEnd_.resize(n);
+  targets_.resize(edges.numEdges());
+  weights_.resize(edges.numEdges());
+  for (idx_t u = 0; u < n; ++u) {
+    idx_t light = edges.begin(u), heavy = edges.end(u);
+    for (idx_t e = edges.begin(u); e < edges.end(u); ++e) {
+      idx_t pos = edges.weight(e) <= delta_ ? light++ : --heavy;
+      targets_[pos] = edges.target(e);
+      weights_[pos] = edges.weight(e);
+    }
+    offsets_[u + 1] = edges.end(u);
+    lightEnd_[u] = light;
+  }
+
+  isSynchronized_ = true;
+  generation_ = graph_->generation();
+  source_ = npos;
+}
+
+template <class Graph>
+void DeltaStepping<Graph>::compute(const idx_t src)
+{
+  synchronize();
+  if (source_ == src) return;
+  const idx_t n = offsets_.size() - 1;
+  std::unique_ptr<std::atomic<val_t>[]> tentative(new std::atomic<val_t>[n]);
+  for (idx_t v = 0; v < n; ++v)
+    tentative[v].store(GL_INF(val_t), std::memory_order_relaxed);
+  tentative[src].store(val_t(0), std::memory_order_relaxed);
+
+  auto bucketOf = [this](const val_t distance) { return idx_t(distance / delta_); };
+
+  // all tentative distances lie within maxWeight of the current bucket, so the buckets can be reused cyclically
+  const idx_t numBuckets = idx_t(maxWeight_ / delta_) + 3;
+  std::vector<std::vector<idx_t>> buckets(numBuckets);
+  std::vector<std::vector<idx_t>> improved(numThreads_);
+  std::vector<idx_t> frontier, removed;
+  std::vector<idx_t> phaseOf(n, npos);
+  idx_t pending = 1, phase = 0;
+  buckets[0].push_back(src);
+
+  // relaxes the light or heavy edges of the given nodes, improved nodes are collected per thread
+  auto relax = [&](const std::vector<idx_t>& nodes, const bool light) {
+    const unsigned threads = nodes.size() < 256 ? 1u : numThreads_;
+    parallelFor(nodes.size(), threads, [&](const std::size_t i, const unsigned thread) {
+      idx_t u = nodes[i];
+      val_t distance = tentative[u].load(std::memory_order_relaxed);
+      idx_t begin = light ? offsets_[u] : lightEnd_[u];
+      idx_t end = light ? lightEnd_[u] : offsets_[u + 1];
+      for (idx_t e = begin; e < end; ++e) {
+        val_t candidate = distance + weights_[e];
+        auto& target = tentative[targets_[e]];
+        val_t current = target.load(std::memory_order_relaxed);
+        while (candidate < current) {
+          if (target.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+            improved[thread].push_back(targets_[e]);
+            break;
+          }
+        }
+      }
+    }, 64);
+    for (auto& list : improved) {
+      for (auto v : list)
+        buckets[bucketOf(tentative[v].load(std::memory_order_relaxed)) % numBuckets].push_back(v);
+      pending += list.size();
+      list.clear();
+    }
+  };
+
+  for (idx_t current = 0; pending > 0; ++current) {
+    auto& bucket = buckets[current % numBuckets];
+    while (!bucket.empty()) {
+      removed.clear();
+      while (!bucket.empty()) {
+        // outdated entries (moved to a lower bucket since) and duplicates are dropped
+        ++phase;
+        frontier.clear();
+        for (auto v : bucket)
+          if (phaseOf[v] != phase && bucketOf(tentative[v].load(std::memory_order_relaxed)) == current) {
+            phaseOf[v] = phase;
+            frontier.push_back(v);
+          }
+        pending -= bucket.size();
+        bucket.clear();
+        removed.insert(removed.end(), frontier.begin(), frontier.end());
+        relax(frontier, true);
+      }
+      // the distances of the bucket are final now; heavy edges only lead to later buckets, barring rounding
+      std::sort(removed.begin(), removed.end());
+      removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+      relax(removed, false);
+    }
+  }
+
+  distance_.resize(n);
+  predecessor_.resize(n);
+  for (idx_t v = 0; v < n; ++v) {
+    distance_[v] = tentative[v].load(std::memory_order_relaxed);
+    predecessor_[v] = v;
+  }
+  // any tight edge is a shortest path tree edge; positive weights keep the tree acyclic
+  for (idx_t u = 0; u < n; ++u) {
+    if (distance_[u] == GL_INF(val_t)) continue;
+    for (idx_t e = offsets_[u]; e < offsets_[u + 1]; ++e) {
+      idx_t v = targets_[e];
+      if (v != src && predecessor_[v] == v && distance_[u] + weights_[e] == distance_[v])
+        predecessor_[v] = u;
+    }
+  }
+  source_ = src;
+}
+
+template <class Graph>
+Distance<typename Graph::val_t> DeltaStepping<Graph>::pathLength(const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(graph_,"DeltaStepping::pathLength | DeltaStepping has not been initialized with a graph.")
+  graph_->checkRange(src,dest);
+  compute(src);
+  return distance_[dest] == GL_INF(val_t) ? Distance<val_t>() : Distance<val_t>(distance_[dest]);
+}
+
+template <class Graph>
+std::pair<bool,typename Graph::idx_list_t> DeltaStepping<Graph>::getPath(const idx_t src, const idx_t dest)
+{
+  GL_ASSERT(graph_,"DeltaStepping::getPath | DeltaStepping has not been initialized with a graph.")
+  graph_->checkRange(src,dest);
+  compute(src);
+  if (distance_[dest] == GL_INF(val_t))
+    return {false,{}};
+  idx_list_t path {dest};
+  for (idx_t node = dest; node != src; node = predecessor_[node])
+    path.push_back(predecessor_[node]);
+  std::reverse(path.begin(), path.end());
+  return {true,path};
+}
+
+template <class Graph>
+void DeltaStepping<Graph>::queryDistances(const idx_t src, std::vector<Distance<val_t>>& distances)
+{
+  std::vector<idx_t> predecessors;
+  queryDistances(src, distances, predecessors);
+}
+
+template <class Graph>
+void DeltaStepping<Graph>::queryDistances(const idx_t src, std::vector<Distance<val_t>>& distances, std::vector<idx_t>& predecessors)
+{
+  GL_ASSERT(graph_,"DeltaStepping::queryDistances | DeltaStepping has not been initialized with a graph.")
+  graph_->checkRange(src);
+  compute(src);
+  distances.resize(distance_.size());
+  for (idx_t v = 0; v < distance_.size(); ++v)
+    distances[v] = distance_[v] == GL_INF(val_t) ? Distance<val_t>() : Distance<val_t>(distance_[v]);
+  predecessors = predecessor_;
+}
+
+template <class Graph>
+typename Graph::val_t DeltaStepping<Graph>::delta()
+{
+  GL_ASSERT(graph_,"DeltaStepping::delta | DeltaStepping has not been initialized with a graph.")
+  synchronize();
+  return delta_;
+}
+
+} // namespace gl::algorithm
+
+#endif // GL_DELTA_STEPPING_HPP
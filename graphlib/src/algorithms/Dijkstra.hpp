@@ -2,8 +2,16 @@
 #define GL_DIJKSTRA_HPP
 
 #include "../gl_base.hpp"
+#include "../structures/BucketQueue.hpp"
+#include "../structures/IndexedDaryHeap.hpp"
+#include "../structures/PathAlgebra.hpp"
+#include "../structures/RadixHeap.hpp"
+#include "../structures/SearchWorkspace.hpp"
+#include "../structures/ShortestPathTree.hpp"
 
-#include <queue>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
 
 namespace gl::algorithm {
 
@@ -12,24 +20,52 @@ namespace gl::algorithm {
 ///////////////////////////////////////////////////////////
 
 /** 
+ * Results are cached per source. If the graph is modified, the cached results are repaired instead of recomputed (Ramalingam-Reps):
+ * only the nodes below a tree edge that got heavier or was deleted, and the nodes whose distance decreases, are visited.
+ * The cache can be bounded by a number of sources or by a memory budget, the least recently used source is evicted first.
+ * For one-off point-to-point queries, queryLength() and queryPath() stop as soon as the destination is settled and do not fill the cache.
+ * On Matrix graphs, full searches select the next node by a linear scan over a flat distance array and relax whole matrix rows (O(n^2)).
+ * On List graphs with integral weights, they use a bucket queue (Dial) if the largest edge weight is at most GL_DIAL_MAX_WEIGHT
+ * and a radix heap otherwise; other weight types use an indexed 4-ary heap.
+ *
+ * The path algebra (see PathAlgebra.hpp) defines how edge weights combine to path values and which value is preferred.
+ * MaxMin computes widest (bottleneck) paths and MaxProduct most reliable paths; both use the indexed heap on List graphs.
+ * Every algebra gets its own instantiation of the search loops, the "distances" returned are path values in that algebra.
  * @class Dijkstra
  * @brief Class that computes Dijkstra's Shortest Paths algorithm.
+ * @tparam Graph Graph type
+ * @tparam ALGEBRA Path algebra, shortest paths by default
  */
 
-template <class Graph>
+template <class Graph, class ALGEBRA = MinPlus<typename Graph::val_t>>
 class Dijkstra {
   using idx_t = typename Graph::idx_t;
   using val_t = typename Graph::val_t;
-  using pair_t = std::pair<Distance<val_t>,idx_t>;
+  using distance_t = Distance<val_t,ALGEBRA>;
+  using pair_t = std::pair<distance_t,idx_t>;
   using result_t = std::vector<pair_t>;
+  using STORAGE_KIND = typename Graph::storage_t;
+  using arc_list_t = typename Graph::edge_change_list_t;
 
 public: 
   /**
-   * This constructor takes a graph argument, ready for usage.
+   * This constructor takes a graph argument, ready for usage. The graph is not copied, it has to outlive the Dijkstra object.
    * @brief Initialized Constructor.
    * @param[in] graph Graph that will be traversed
    */
-  explicit Dijkstra(const Graph graph);    ///< Constructor with Graph included
+  explicit Dijkstra(const Graph& graph);
+  /**
+   * This constructor takes ownership of a temporary graph.
+   * @brief Initialized Constructor.
+   * @param[in] graph Graph that will be traversed
+   */
+  explicit Dijkstra(Graph&& graph);
+  /**
+   * This constructor shares the ownership of the graph with the given handle.
+   * @brief Initialized Constructor.
+   * @param[in] graph Handle to the graph that will be traversed
+   */
+  explicit Dijkstra(const SharedGraph<Graph>& graph);
 
   Dijkstra();                                          ///< Default constructor
   Dijkstra(const Dijkstra &) = default;                ///< Copy constructor
@@ -38,7 +74,7 @@ public:
   Dijkstra &operator=(Dijkstra &&) noexcept = default; ///< Move assignment
   ~Dijkstra() = default;                               ///< Default destructor
 
-  Distance<val_t> pathLength(const idx_t src, const idx_t dest);
+  distance_t pathLength(const idx_t src, const idx_t dest);
   /**
    * @brief Computes the node sequence that represents the shortest path from src to dest.
    * @param[in] src Start of shortest path
@@ -47,171 +83,808 @@ public:
    */
   std::pair<bool,typename Graph::idx_list_t> getPath(const idx_t src, const idx_t dest);
   /**
+   * @brief Returns the SPT (Shortest Path Tree) of src as a view over the cached predecessors. O(n), no graph is built.
+   * @param[in] src Node whose SPT is to be known
+   * @return SPT view.
+   */
+  ShortestPathTree<Graph> getShortestPathTree(const idx_t src);
+  /**
+   * Materializes getShortestPathTree(src) as a Graph. Prefer the view unless a Graph is really needed.
    * @brief Returns a graph that only contains the edges of the SPT (Shortest Path Tree)
    * @param[in] src Node whose SPT is to be known
    * @return SPT Graph.
    */
   Graph getSPT(const idx_t src);
   /**
-   * @brief Initializes the algorithm with a new Graph
+   * @brief Initializes the algorithm with a new Graph. The graph is not copied, it has to outlive the Dijkstra object.
    * @param[in] graph Graph storing information for the Shortest Path Algorithm
    */
-  void initialize(const Graph graph);
+  void initialize(const Graph& graph);
+  /**
+   * @brief Initializes the algorithm with a new shared Graph.
+   * @param[in] graph Handle to the graph storing information for the Shortest Path Algorithm
+   */
+  void initialize(const SharedGraph<Graph>& graph);
+  /**
+   * @brief Checks whether the shortest paths from src are cached and still valid for the current state of the graph.
+   * @param[in] src Source node
+   * @return true if a query from src can be answered without recomputation, false otherwise.
+   */
+  bool isCached(const idx_t src);
+  /**
+   * Lowering the capacity evicts the least recently used sources right away.
+   * @brief Limits the number of sources whose results are cached.
+   * @param[in] maxSources Largest number of cached sources, 0 for no limit (default).
+   */
+  void setCacheCapacity(const idx_t maxSources);
+  /**
+   * Every cached source costs the same amount of memory (one distance and one predecessor per node), so the budget is
+   * converted into a number of sources. At least one source is always kept, even if it exceeds the budget.
+   * @brief Limits the memory used by cached results.
+   * @param[in] bytes Memory budget in bytes, 0 for no limit (default).
+   */
+  void setCacheMemoryLimit(const std::size_t bytes);
+  /**
+   * @brief Number of sources whose results are cached and still valid for the current state of the graph.
+   * @return Number of cached sources.
+   */
+  idx_t numCached();
+  /**
+   * Point-to-point queries that find a cached result are counted as well.
+   * @brief Number of pathLength(), getPath() and getShortestPathTree() calls answered from the cache.
+   * @return Number of cache hits.
+   */
+  std::size_t cacheHits() const;
+  /**
+   * @brief Number of pathLength(), getPath() and getShortestPathTree() calls that had to run a full search.
+   * @return Number of cache misses.
+   */
+  std::size_t cacheMisses() const;
+  /**
+   * @brief Sets the hit and miss counters to zero.
+   */
+  void resetCacheStatistics();
+  /**
+   * The search stops as soon as dest is settled and reuses a workspace whose cost only depends on the explored part of the graph.
+   * Nothing is cached, but a cached result for src is used if available.
+   * @brief Computes the length of the shortest path from src to dest (point-to-point query).
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return Length of the shortest path, infinite if dest is unreachable.
+   */
+  distance_t queryLength(const idx_t src, const idx_t dest);
+  /**
+   * @brief Computes the node sequence of the shortest path from src to dest (point-to-point query, see queryLength()).
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return pair of (true, path) if dest is reachable, (false, {}) otherwise.
+   */
+  std::pair<bool,typename Graph::idx_list_t> queryPath(const idx_t src, const idx_t dest);
+  /**
+   * Runs a full search in the point-to-point workspace: unlike pathLength(), the cache is not filled.
+   * A cached result for src is used if available.
+   * @brief Computes the distances from src to all nodes.
+   * @param[in] src Source node
+   * @param[out] distances Distance of every node from src, infinite if unreachable.
+   */
+  void queryDistances(const idx_t src, std::vector<distance_t>& distances);
+  /**
+   * @brief Computes the distances from src to all nodes and their predecessors on the shortest path tree (see queryDistances()).
+   * @param[in] src Source node
+   * @param[out] distances Distance of every node from src, infinite if unreachable.
+   * @param[out] predecessors Predecessor of every node, the node itself for src and unreachable nodes.
+   */
+  void queryDistances(const idx_t src, std::vector<distance_t>& distances, std::vector<idx_t>& predecessors);
 
 private:  
 
+  /**
+   * @brief Runs Dijkstra from src in the workspace until dest is settled.
+   * @param[in] src Source node
+   * @param[in] dest Target node
+   * @return true if dest is reachable from src.
+   */
+  bool search(const idx_t src, const idx_t dest);
+
   /**
    * @brief Computation. This is where the shortest distances and the predecessors of each node on the shortest path tree get computed.
    * @param[in] src Source node. All shortest paths will be computed from here.
    */
   void compute(const idx_t src);
+  /**
+   * @brief Returns the result of src, computing it on a miss, and marks it as most recently used.
+   * @param[in] src Source node
+   * @return Distances & predecessors of all nodes.
+   */
+  const result_t& cached(const idx_t src);
+  /**
+   * @brief Moves a cached source to the front of the LRU list, inserting it if needed.
+   * @param[in] src Source node
+   */
+  void touch(const idx_t src);
+  /**
+   * @brief Drops the cached result of src and releases its memory.
+   * @param[in] src Source node
+   */
+  void evict(const idx_t src);
+  /**
+   * @brief Evicts least recently used sources until at most 'keep' sources are cached.
+   * @param[in] keep Number of sources that may stay cached
+   */
+  void shrinkCache(const idx_t keep);
+  /**
+   * @brief Largest number of cached sources allowed by the capacity and the memory limit.
+   * @return Number of sources, the number of nodes if unlimited.
+   */
+  idx_t cacheCapacity() const;
+  /**
+   * @brief Resets the cache to an empty one for numNodes sources.
+   * @param[in] numNodes Number of nodes of the graph
+   */
+  void clearCache(const idx_t numNodes);
+  /**
+   * @brief Computes the shortest distances on a Matrix graph with linear scan selection and row relaxation.
+   * @param[in] src Source node
+   * @param[out] out Distances & predecessors of all nodes, the predecessor of src has to be src.
+   */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  GL_ENABLE_IF_MATRIX
+#endif
+  void computeLabels(const idx_t src, result_t& out);
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  /**
+   * @brief Computes the shortest distances on a List graph with the priority queue that suits the weight type.
+   */
+  GL_ENABLE_IF_LIST
+  void computeLabels(const idx_t src, result_t& out);
+#endif
+  /**
+   * @brief Computes the shortest distances with an indexed heap with decrease-key.
+   * @param[in] src Source node
+   * @param[out] out Distances & predecessors of all nodes, the predecessor of src has to be src.
+   */
+  void computeHeap(const idx_t src, result_t& out);
+  /**
+   * @brief Computes the shortest distances with a monotone integer queue (BucketQueue or RadixHeap) and lazy deletion.
+   * @param[in] src Source node
+   * @param[in] queue Empty queue
+   * @param[out] out Distances & predecessors of all nodes, the predecessor of src has to be src.
+   */
+  template <class Queue>
+  void computeMonotone(const idx_t src, Queue& queue, result_t& out);
+  /**
+   * If the graph has been modified since the cached results were computed, every cached result is repaired.
+   * All results are dropped if the change log of the graph does not cover the modifications or if an edge weight is no longer positive.
+   * @brief Brings the cached results up to date with the generation of the graph.
+   */
+  void synchronize();
+  /**
+   * The subtrees below tree edges that got heavier or were deleted lose their distances and get estimates from their
+   * incoming edges. Together with the heads of edges that now provide shorter paths, they seed a Dijkstra search that only
+   * continues from nodes whose distance changes.
+   * @brief Updates the cached result of src to the modified edges.
+   * @param[in] src Source of the cached result
+   * @param[in] arcs Sorted list of modified edges, in both orientations for undirected graphs
+   */
+  void repair(const idx_t src, const arc_list_t& arcs);
+  /**
+   * @brief Builds the lists of incoming edges of a directed graph, which repair() needs for the estimates.
+   */
+  void buildInEdges();
+
+  enum : unsigned char { UNREACHED = 0, REACHED = 1, SETTLED = 2 }; ///< @brief Search state of a node in compute()
 
   
   bool isInitializedWithGraph_; ///< @brief Boolean indicating whether the class has been initialized with a Graph.
   std::vector<bool> isInitializedWithSource_; ///< @brief Boolean vector indicating whether the node whose ID corresponds to an element in the vector had its shortest path tree computed
-  Graph graph_;                   ///< @brief Source Graph
-  // TODO: make pointer to prevent copies
+  SharedGraph<Graph> graph_;      ///< @brief Source Graph (shared or viewed, never copied)
+  typename Graph::generation_t generation_ = 0; ///< @brief Generation of the graph the cached results are valid for
 
-  std::vector<Graph> result_;     ///< @brief SPT graph
   std::vector<result_t> final_;   ///< @brief Shortest Path lengths & predecessors
+  std::vector<idx_t> lruPrev_;    ///< @brief Previous (more recently used) cached source, index numNodes is the list sentinel
+  std::vector<idx_t> lruNext_;    ///< @brief Next (less recently used) cached source, index numNodes is the list sentinel
+  idx_t numCached_ = 0;           ///< @brief Number of cached sources
+  idx_t maxSources_ = 0;          ///< @brief Capacity set by setCacheCapacity(), 0 if unlimited
+  std::size_t maxBytes_ = 0;      ///< @brief Budget set by setCacheMemoryLimit(), 0 if unlimited
+  std::size_t hits_ = 0;          ///< @brief Number of cache hits
+  std::size_t misses_ = 0;        ///< @brief Number of cache misses
+  SearchWorkspace<val_t,ALGEBRA> workspace_; ///< @brief Scratch memory of point-to-point queries
+  std::vector<typename Graph::dest_vec_t> inEdges_; ///< @brief Incoming edges of every node of a directed graph, empty until a repair needs them
+  std::vector<unsigned char> affected_;      ///< @brief Marks the nodes whose distance is recomputed by repair()
+  typename Graph::idx_list_t affectedList_; ///< @brief Nodes whose distance is recomputed by repair()
+  IndexedDaryHeap<val_t> repairQueue_;       ///< @brief Queue of repair()
+  typename Graph::dest_vec_t neighbours_;    ///< @brief Scratch memory for neighbour lists
 };
 
 ///////////////////////////////////////////////////////////
 //    Member function implementations
 ///////////////////////////////////////////////////////////
 
-template <class Graph>
-Dijkstra<Graph>::Dijkstra() : isInitializedWithGraph_(false),
-                              isInitializedWithSource_(1,false) {}
+template <class Graph, class ALGEBRA>
+Dijkstra<Graph,ALGEBRA>::Dijkstra() : isInitializedWithGraph_(false)
+{
+  clearCache(1);
+}
+
+template <class Graph, class ALGEBRA>
+Dijkstra<Graph,ALGEBRA>::Dijkstra(const Graph& graph) : Dijkstra(SharedGraph<Graph>::view(graph)) {}
 
-template <class Graph>
-Dijkstra<Graph>::Dijkstra(Graph graph) : isInitializedWithGraph_(true),                                         isInitializedWithSource_(graph.numNodes(),false),   
-                                         graph_(graph),
-                                         result_(graph.numNodes()),
-                                         final_(graph.numNodes()) {}
+template <class Graph, class ALGEBRA>
+Dijkstra<Graph,ALGEBRA>::Dijkstra(Graph&& graph) : Dijkstra(SharedGraph<Graph>(std::move(graph))) {}
+
+template <class Graph, class ALGEBRA>
+Dijkstra<Graph,ALGEBRA>::Dijkstra(const SharedGraph<Graph>& graph) : isInitializedWithGraph_(true),
+                                                             graph_(graph),
+                                                             generation_(graph->generation())
+{
+  clearCache(graph->numNodes());
+}
 
-template <class Graph>
-void Dijkstra<Graph>::compute(const idx_t src)
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::compute(const idx_t src)
 {
   // range has been checked in calling functions
 
-  // verify that all non-self-loop edge weights are positive
-  for (auto it = graph_.edge_cbegin(); it != graph_.edge_cend(); ++it) {
-    if (it->source() != it->dest()) {
-      GL_ASSERT(it->weight() > 0, "Dijkstra::compute | Found non-positive edge weights in the graph.");
-    }
+  // verify that no edge makes a path more preferable, e.g. that all non-self-loop edge weights are positive (O(1) via the graph statistics)
+  GL_ASSERT(ALGEBRA::admits(*graph_), std::string("Dijkstra::compute | ") + ALGEBRA::inadmissibleWeights());
+
+  std::vector<pair_t> out (graph_->numNodes());
+  out[src].second = src;
+  computeLabels(src, out);
+  shrinkCache(cacheCapacity() - 1);
+  final_[src] = std::move(out);
+  isInitializedWithSource_[src] = true;
+  touch(src);
+}
+
+template <class Graph, class ALGEBRA>
+const typename Dijkstra<Graph,ALGEBRA>::result_t& Dijkstra<Graph,ALGEBRA>::cached(const idx_t src)
+{
+  if (isInitializedWithSource_[src]) {
+    ++hits_;
+    touch(src);
+  } else {
+    ++misses_;
+    compute(src);
+  }
+  return final_[src];
+}
+
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::touch(const idx_t src)
+{
+  const idx_t sentinel = lruNext_.size() - 1;
+  if (lruNext_[sentinel] == src) return;
+  if (lruPrev_[src] != src || lruNext_[src] != src) {
+    // unlink, src is already cached
+    lruNext_[lruPrev_[src]] = lruNext_[src];
+    lruPrev_[lruNext_[src]] = lruPrev_[src];
+  } else {
+    ++numCached_;
+  }
+  lruPrev_[src] = sentinel;
+  lruNext_[src] = lruNext_[sentinel];
+  lruPrev_[lruNext_[sentinel]] = src;
+  lruNext_[sentinel] = src;
+}
+
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::evict(const idx_t src)
+{
+  lruNext_[lruPrev_[src]] = lruNext_[src];
+  lruPrev_[lruNext_[src]] = lruPrev_[src];
+  lruPrev_[src] = src;
+  lruNext_[src] = src;
+  --numCached_;
+  isInitializedWithSource_[src] = false;
+  result_t().swap(final_[src]);
+}
+
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::shrinkCache(const idx_t keep)
+{
+  const idx_t sentinel = lruNext_.size() - 1;
+  while (numCached_ > keep)
+    evict(lruPrev_[sentinel]);
+}
+
+template <class Graph, class ALGEBRA>
+typename Dijkstra<Graph,ALGEBRA>::idx_t Dijkstra<Graph,ALGEBRA>::cacheCapacity() const
+{
+  idx_t capacity = lruNext_.size() - 1;
+  if (maxSources_ != 0 && maxSources_ < capacity)
+    capacity = maxSources_;
+  if (maxBytes_ != 0) {
+    const std::size_t entryBytes = sizeof(result_t) + (lruNext_.size() - 1) * sizeof(pair_t);
+    const std::size_t fitting = std::max<std::size_t>(maxBytes_ / entryBytes, 1);
+    if (fitting < capacity)
+      capacity = fitting;
+  }
+  return capacity;
+}
+
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::clearCache(const idx_t numNodes)
+{
+  isInitializedWithSource_.assign(numNodes,false);
+  final_.assign(numNodes,result_t());
+  lruPrev_.resize(numNodes+1);
+  lruNext_.resize(numNodes+1);
+  for (idx_t i = 0; i <= numNodes; ++i) {
+    lruPrev_[i] = i;
+    lruNext_[i] = i;
   }
+  numCached_ = 0;
+}
 
-  // priority queue sorting (possibly non-trivial due to usage of Distance)
-  class prio {
-    public:
-      bool operator() (pair_t& lhs, pair_t& rhs) {
-        return lhs.first > rhs.first;
+template <class Graph, class ALGEBRA>
+template <typename STORAGE, std::enable_if_t<GL_IS_MATRIX, int>*>
+void Dijkstra<Graph,ALGEBRA>::computeLabels(const idx_t src, result_t& out)
+{
+  // dense graphs: every settled node scans a whole row anyway, so a heap cannot beat a linear scan selection
+  const idx_t n = graph_->numNodes();
+  std::vector<val_t> key(n, GL_INF(val_t));  // priority of reached, unsettled nodes; GL_INF otherwise
+  std::vector<val_t> distance(n, ALGEBRA::zero());
+  std::vector<unsigned char> settled(n, 0);
+  key[src] = ALGEBRA::priority(ALGEBRA::one());
+  distance[src] = ALGEBRA::one();
+
+  for (;;) {
+    // branch-free min-reduction over the flat array, then the first node holding the minimum
+    val_t best = GL_INF(val_t);
+    for (idx_t v = 0; v < n; ++v)
+      best = key[v] < best ? key[v] : best;
+    if (best == GL_INF(val_t)) break;
+    idx_t u = 0;
+    while (key[u] != best) ++u;
+
+    key[u] = GL_INF(val_t);
+    settled[u] = 1;
+    const val_t value = distance[u];
+    auto relax = [&](const idx_t v, const typename Graph::Edge& edge) {
+      if (!edge.exists() || settled[v]) return;
+      val_t candidate = ALGEBRA::extend(value, edge.weight());
+      if (ALGEBRA::better(candidate, distance[v])) {
+        distance[v] = candidate;
+        key[v] = ALGEBRA::priority(candidate);
+        out[v].second = u;
       }
-  };
+    };
+    // undirected matrices only store the upper triangle: edges to smaller IDs are in column u
+    const auto* row = graph_->getEdgeRow(u);
+    idx_t first = 0;
+    if (!graph_->isDirected()) {
+      const auto* matrix = graph_->getEdgeRow(0);
+      for (; first < u; ++first)
+        relax(first, matrix[first * n + u]);
+    }
+    for (idx_t v = first; v < n; ++v)
+      relax(v, row[v]);
+  }
+  for (idx_t v = 0; v < n; ++v)
+    if (settled[v]) out[v].first = distance_t(distance[v]);
+}
 
-  std::priority_queue<pair_t,std::vector<pair_t>,prio> pq;
-  typename Graph::visit_list_t visited (graph_.numNodes());
-  std::vector<pair_t> out (graph_.numNodes());
+template <class Graph, class ALGEBRA>
+template <typename STORAGE, std::enable_if_t<GL_IS_LIST, int>*>
+void Dijkstra<Graph,ALGEBRA>::computeLabels(const idx_t src, result_t& out)
+{
+  if constexpr (std::is_integral_v<val_t> && std::is_same_v<ALGEBRA, MinPlus<val_t>>) {
+    // integer keys allow monotone queues: Dial's buckets for small weights, a radix heap for everything else
+    const val_t maxWeight = graph_->maxEdgeWeight();
+    if (maxWeight <= val_t(GL_DIAL_MAX_WEIGHT)) {
+      BucketQueue<val_t> queue(maxWeight < val_t(0) ? val_t(0) : maxWeight);
+      computeMonotone(src, queue, out);
+    } else {
+      RadixHeap<val_t> queue;
+      computeMonotone(src, queue, out);
+    }
+  } else {
+    computeHeap(src, out);
+  }
+}
 
-  pq.push(std::make_pair(0,src));
-  out[src] = std::make_pair(idx_t(0),src);
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::computeHeap(const idx_t src, result_t& out)
+{
+  // indexed heap with decrease-key: at most one entry per node, plain scalar keys
+  const idx_t n = graph_->numNodes();
+  IndexedDaryHeap<val_t> heap(n);
+  std::vector<val_t> distance(n);
+  std::vector<unsigned char> state(n, UNREACHED);
+
+  distance[src] = ALGEBRA::one();
+  state[src] = REACHED;
+  heap.push(src, ALGEBRA::priority(ALGEBRA::one()));
+
+  while (!heap.empty()) {
+    idx_t u = heap.pop().second;
+    state[u] = SETTLED;
+    graph_->getNeighbourWeights(u, neighbours_);
+    for (const auto& x : neighbours_) {
+      idx_t v = x.first;
+      if (state[v] == SETTLED) continue;
+      val_t candidate = ALGEBRA::extend(distance[u], x.second);
+      if (state[v] == UNREACHED) {
+        // no path is never queued
+        if (!ALGEBRA::better(candidate, ALGEBRA::zero())) continue;
+        state[v] = REACHED;
+        distance[v] = candidate;
+        out[v].second = u;
+        heap.push(v, ALGEBRA::priority(candidate));
+      } else if (ALGEBRA::better(candidate, distance[v])) {
+        distance[v] = candidate;
+        out[v].second = u;
+        heap.decrease(v, ALGEBRA::priority(candidate));
+      }
+    }
+  }
+  for (idx_t v = 0; v < n; ++v)
+    if (state[v] != UNREACHED) out[v].first = distance_t(distance[v]);
+}
 
-  while (!pq.empty()) {
-    idx_t u = pq.top().second;
-    pq.pop();
-    if(visited[u]) continue;
-    visited[u] = true;
-    auto neighbours = graph_.getUnvisitedNeighbourWeights(u,visited);
-    for (const auto& x : neighbours) {
+template <class Graph, class ALGEBRA>
+template <class Queue>
+void Dijkstra<Graph,ALGEBRA>::computeMonotone(const idx_t src, Queue& queue, result_t& out)
+{
+  // no decrease-key: improvements push a new entry, outdated entries are skipped when popped
+  const idx_t n = graph_->numNodes();
+  std::vector<val_t> distance(n);
+  std::vector<unsigned char> state(n, UNREACHED);
+
+  distance[src] = val_t(0);
+  state[src] = REACHED;
+  queue.push(val_t(0), src);
+
+  while (!queue.empty()) {
+    auto top = queue.pop();
+    idx_t u = top.second;
+    if (state[u] == SETTLED || distance[u] < top.first) continue;
+    state[u] = SETTLED;
+    graph_->getNeighbourWeights(u, neighbours_);
+    for (const auto& x : neighbours_) {
       idx_t v = x.first;
-      Distance<val_t> temp_weight (x.second);
-      if(out[v].first > out[u].first + temp_weight) {
-        out[v] = std::make_pair(out[u].first + temp_weight,u);
-        pq.push(std::make_pair(out[v].first, v));
+      if (state[v] == SETTLED) continue;
+      val_t candidate = top.first + x.second;
+      if (state[v] == UNREACHED || candidate < distance[v]) {
+        state[v] = REACHED;
+        distance[v] = candidate;
+        out[v].second = u;
+        queue.push(candidate, v);
       }
     }
   }
-  final_[src] = out;
-  isInitializedWithSource_[src] = true;
+  for (idx_t v = 0; v < n; ++v)
+    if (state[v] != UNREACHED) out[v].first = distance_t(distance[v]);
+}
+
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::synchronize()
+{
+  if (generation_ == graph_->generation())
+    return;
 
-  Graph result(graph_.numNodes(),std::string(std::string("SPT of node ")+std::to_string(src)+std::string(" in ")+graph_.getGraphLabel()));
-  for (idx_t i = 0; i < graph_.numNodes(); ++i)
+  auto changes = graph_->getEdgeChangesSince(generation_);
+  generation_ = graph_->generation();
+  if (!changes.first)
   {
-    auto path = getPath(src, i);
-    if (path.first) {
-      idx_t i = 0;
-      for (idx_t j = i+1; j < path.second.size(); ++i, ++j)
+    // the graph may have been replaced by one of a different size
+    inEdges_.clear();
+    clearCache(graph_->numNodes());
+    return;
+  }
+  // modified edges in both orientations for undirected graphs, self-loops are never part of a shortest path
+  arc_list_t arcs;
+  for (const auto& change : changes.second)
+  {
+    if (change.first == change.second) continue;
+    arcs.push_back(change);
+    if (graph_->isUndirected())
+      arcs.emplace_back(change.second, change.first);
+  }
+  std::sort(arcs.begin(), arcs.end());
+  arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+
+  if (!inEdges_.empty())
+  {
+    for (const auto& arc : arcs)
+    {
+      auto& in = inEdges_[arc.second];
+      in.erase(std::remove_if(in.begin(), in.end(), [&arc](const auto& x) { return x.first == arc.first; }), in.end());
+      if (graph_->hasEdge(arc.first, arc.second))
+        in.emplace_back(arc.first, graph_->getEdgeWeight(arc.first, arc.second));
+    }
+  }
+  if (numCached_ == 0 || arcs.empty())
+    return;
+  if (!ALGEBRA::admits(*graph_))
+  {
+    shrinkCache(0);
+    return;
+  }
+  if (graph_->isDirected() && inEdges_.empty())
+    buildInEdges();
+  const idx_t n = graph_->numNodes();
+  if (affected_.size() != n)
+  {
+    affected_.assign(n, 0);
+    repairQueue_.resize(n);
+  }
+  const idx_t sentinel = lruNext_.size() - 1;
+  for (idx_t src = lruNext_[sentinel]; src != sentinel; src = lruNext_[src])
+    repair(src, arcs);
+}
+
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::buildInEdges()
+{
+  const idx_t n = graph_->numNodes();
+  inEdges_.assign(n, typename Graph::dest_vec_t());
+  for (idx_t u = 0; u < n; ++u)
+  {
+    graph_->getNeighbourWeights(u, neighbours_);
+    for (const auto& x : neighbours_)
+      if (x.first != u) inEdges_[x.first].emplace_back(u, x.second);
+  }
+}
+
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::repair(const idx_t src, const arc_list_t& arcs)
+{
+  result_t& result = final_[src];
+  auto distance = [&result](const idx_t node) { return result[node].first.scalarDistance(); };
+  auto improve = [&](const idx_t node, const val_t candidate, const idx_t predecessor) {
+    if (!ALGEBRA::better(candidate, distance(node))) return;
+    result[node] = {distance_t(candidate), predecessor};
+    repairQueue_.pushOrDecrease(node, ALGEBRA::priority(candidate));
+  };
+
+  // collect the subtrees below tree edges that got heavier or were deleted
+  affectedList_.clear();
+  for (const auto& arc : arcs)
+  {
+    const idx_t u = arc.first, v = arc.second;
+    if (v == src || affected_[v] || result[v].first.isInfinite() || result[v].second != u) continue;
+    if (graph_->hasEdge(u, v) && !ALGEBRA::better(distance(v), ALGEBRA::extend(distance(u), graph_->getEdgeWeight(u, v)))) continue;
+    affected_[v] = 1;
+    affectedList_.push_back(v);
+    for (idx_t i = affectedList_.size() - 1; i < affectedList_.size(); ++i)
+    {
+      const idx_t x = affectedList_[i];
+      graph_->getNeighbourWeights(x, neighbours_);
+      for (const auto& y : neighbours_)
       {
-        if (!result.hasEdge(path.second[i],path.second[j])) 
-        {
-          result.setEdge(path.second[i],path.second[j],graph_.getEdgeWeight(path.second[i],path.second[j]),graph_.getEdgeColor(path.second[i],path.second[j]));
-        }
+        if (y.first == src || affected_[y.first] || result[y.first].first.isInfinite() || result[y.first].second != x) continue;
+        affected_[y.first] = 1;
+        affectedList_.push_back(y.first);
       }
     }
   }
-  result_[src] = result;
+  for (auto a : affectedList_)
+    result[a] = {distance_t(), a};
+  // estimates of the affected nodes through their unaffected predecessors
+  for (auto a : affectedList_)
+  {
+    if (graph_->isDirected())
+      neighbours_ = inEdges_[a];
+    else
+      graph_->getNeighbourWeights(a, neighbours_);
+    for (const auto& x : neighbours_)
+      if (!affected_[x.first] && !result[x.first].first.isInfinite())
+        improve(a, ALGEBRA::extend(distance(x.first), x.second), x.first);
+  }
+  for (auto a : affectedList_)
+    affected_[a] = 0;
+  // modified edges that now provide shorter paths
+  for (const auto& arc : arcs)
+  {
+    if (!result[arc.first].first.isInfinite() && graph_->hasEdge(arc.first, arc.second))
+      improve(arc.second, ALGEBRA::extend(distance(arc.first), graph_->getEdgeWeight(arc.first, arc.second)), arc.first);
+  }
+  // admissible weights: every node leaves the queue once, with its final distance
+  while (!repairQueue_.empty())
+  {
+    const idx_t u = repairQueue_.pop().second;
+    graph_->getNeighbourWeights(u, neighbours_);
+    for (const auto& x : neighbours_)
+      improve(x.first, ALGEBRA::extend(distance(u), x.second), u);
+  }
+}
+
+template <class Graph, class ALGEBRA>
+bool Dijkstra<Graph,ALGEBRA>::isCached (const idx_t src) {
+  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::isCached | Dijkstra has not been initialized with a graph.")
+  graph_->checkRange(src);
+  synchronize();
+  return isInitializedWithSource_[src];
+}
+
+template <class Graph, class ALGEBRA>
+bool Dijkstra<Graph,ALGEBRA>::search (const idx_t src, const idx_t dest) {
+  GL_ASSERT(ALGEBRA::admits(*graph_), std::string("Dijkstra::search | ") + ALGEBRA::inadmissibleWeights());
+  if (workspace_.size() != graph_->numNodes())
+    workspace_.resize(graph_->numNodes());
+  else
+    workspace_.reset();
+
+  workspace_.relax(src, ALGEBRA::one(), src);
+  while (!workspace_.empty()) {
+    auto top = workspace_.pop();
+    idx_t u = top.second;
+    if (workspace_.isSettled(u) || top.first > ALGEBRA::priority(workspace_.distance(u))) continue;
+    workspace_.settle(u);
+    if (u == dest) return true;
+    graph_->getNeighbourWeights(u, neighbours_);
+    for (const auto& x : neighbours_) {
+      workspace_.relax(x.first, ALGEBRA::extend(workspace_.distance(u), x.second), u);
+    }
+  }
+  return false;
 }
 
-template <class Graph>
-gl::Distance<typename Graph::val_t> Dijkstra<Graph>::pathLength (const idx_t src, const idx_t dest) {
-  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::pathLength | Dijkstra has not been initialized with a graph.")
-  graph_.checkRange(src,dest);
-  
-  if (!isInitializedWithSource_[src])
-    compute(src);
+template <class Graph, class ALGEBRA>
+typename Dijkstra<Graph,ALGEBRA>::distance_t Dijkstra<Graph,ALGEBRA>::queryLength (const idx_t src, const idx_t dest) {
+  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::queryLength | Dijkstra has not been initialized with a graph.")
+  graph_->checkRange(src,dest);
+  synchronize();
+  if (isInitializedWithSource_[src])
+    return cached(src)[dest].first;
+  if (!search(src, dest))
+    return distance_t();
+  return distance_t(workspace_.distance(dest));
+}
 
-  return final_[src][dest].first;
+template <class Graph, class ALGEBRA>
+std::pair<bool,typename Graph::idx_list_t> Dijkstra<Graph,ALGEBRA>::queryPath (const idx_t src, const idx_t dest) {
+  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::queryPath | Dijkstra has not been initialized with a graph.")
+  graph_->checkRange(src,dest);
+  synchronize();
+  if (isInitializedWithSource_[src])
+    return getPath(src, dest);
+  if (!search(src, dest))
+    return {false,{}};
+  return {true,workspace_.path(dest)};
 }
 
-template <class Graph>
-std::pair<bool,typename Graph::idx_list_t> Dijkstra<Graph>::getPath (const idx_t src, const idx_t dest) {
-  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::getPath | Dijkstra has not been initialized with a graph.")
-  graph_.checkRange(src,dest);  
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::queryDistances (const idx_t src, std::vector<distance_t>& distances) {
+  std::vector<idx_t> predecessors;
+  queryDistances(src, distances, predecessors);
+}
 
-  if (!isInitializedWithSource_[src])
-    compute(src);
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::queryDistances (const idx_t src, std::vector<distance_t>& distances, std::vector<idx_t>& predecessors) {
+  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::queryDistances | Dijkstra has not been initialized with a graph.")
+  graph_->checkRange(src);
+  synchronize();
+  const idx_t n = graph_->numNodes();
+  distances.assign(n, distance_t());
+  predecessors.resize(n);
+  for (idx_t i = 0; i < n; ++i)
+    predecessors[i] = i;
+  if (isInitializedWithSource_[src]) {
+    const result_t& result = cached(src);
+    for (idx_t i = 0; i < n; ++i) {
+      distances[i] = result[i].first;
+      if (!distances[i].isInfinite()) predecessors[i] = result[i].second;
+    }
+    return;
+  }
+  search(src, n); // no node has ID n, so the search exhausts the graph
+  for (auto node : workspace_.touched()) {
+    distances[node] = distance_t(workspace_.distance(node));
+    predecessors[node] = workspace_.predecessor(node);
+  }
+}
+
+template <class Graph, class ALGEBRA>
+typename Dijkstra<Graph,ALGEBRA>::distance_t Dijkstra<Graph,ALGEBRA>::pathLength (const idx_t src, const idx_t dest) {
+  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::pathLength | Dijkstra has not been initialized with a graph.")
+  graph_->checkRange(src,dest);
+  synchronize();
+  return cached(src)[dest].first;
+}
+
+template <class Graph, class ALGEBRA>
+std::pair<bool,typename Graph::idx_list_t> Dijkstra<Graph,ALGEBRA>::getPath (const idx_t src, const idx_t dest) {
+  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::getPath | Dijkstra has not been initialized with a graph.")
+  graph_->checkRange(src,dest);  
+  synchronize();
+  const result_t& result = cached(src);
 
   typename Graph::idx_list_t out;
-  if (pathLength(src,dest).isInfinite())
+  if (result[dest].first.isInfinite())
   {
     return {false,{}};
   }
   idx_t node = dest;
   while (node != src) {
     out.push_back(node);
-    node = final_[src][node].second;
+    node = result[node].second;
   }
   out.push_back(src);
   std::reverse(out.begin(),out.end());
   return {true,out};
 }
 
-template <class Graph>
-Graph Dijkstra<Graph>::getSPT (const idx_t src) 
+template <class Graph, class ALGEBRA>
+ShortestPathTree<Graph> Dijkstra<Graph,ALGEBRA>::getShortestPathTree (const idx_t src)
+{
+  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::getShortestPathTree | Dijkstra has not been initialized with a graph.")
+  graph_->checkRange(src);
+  synchronize();
+  const result_t& result = cached(src);
+
+  std::vector<idx_t> parents(graph_->numNodes());
+  for (idx_t v = 0; v < parents.size(); ++v)
+    parents[v] = result[v].first.isInfinite() ? v : result[v].second;
+  return ShortestPathTree<Graph>(graph_, src, std::move(parents));
+}
+
+template <class Graph, class ALGEBRA>
+Graph Dijkstra<Graph,ALGEBRA>::getSPT (const idx_t src) 
 {
   GL_ASSERT(isInitializedWithGraph_,"Dijkstra::getSPT | Dijkstra has not been initialized with a graph.")
-  graph_.checkRange(src);  
-  if (!isInitializedWithSource_[src])
-    compute(src);
+  return getShortestPathTree(src).toGraph();
+}
 
-  return result_[src];
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::initialize (const Graph& graph)
+{
+  initialize(SharedGraph<Graph>::view(graph));
 }
 
-template <class Graph>
-void Dijkstra<Graph>::initialize (const Graph graph)
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::initialize (const SharedGraph<Graph>& graph)
 {
-  std::vector<bool> isInitializedWithSource (graph.numNodes(),false);
-  isInitializedWithSource = isInitializedWithSource_;
   graph_ = graph;
-
-  std::vector<Graph> result (graph.numNodes());
-  result_ = result;
-  std::vector<result_t> final (graph.numNodes());
-  final_ = final;
+  generation_ = graph->generation();
+  clearCache(graph->numNodes());
+  inEdges_.clear();
   isInitializedWithGraph_ = true;
 }
 
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::setCacheCapacity (const idx_t maxSources)
+{
+  maxSources_ = maxSources;
+  shrinkCache(cacheCapacity());
+}
+
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::setCacheMemoryLimit (const std::size_t bytes)
+{
+  maxBytes_ = bytes;
+  shrinkCache(cacheCapacity());
+}
+
+template <class Graph, class ALGEBRA>
+typename Dijkstra<Graph,ALGEBRA>::idx_t Dijkstra<Graph,ALGEBRA>::numCached ()
+{
+  GL_ASSERT(isInitializedWithGraph_,"Dijkstra::numCached | Dijkstra has not been initialized with a graph.")
+  synchronize();
+  return numCached_;
+}
+
+template <class Graph, class ALGEBRA>
+std::size_t Dijkstra<Graph,ALGEBRA>::cacheHits () const
+{
+  return hits_;
+}
+
+template <class Graph, class ALGEBRA>
+std::size_t Dijkstra<Graph,ALGEBRA>::cacheMisses () const
+{
+  return misses_;
+}
+
+template <class Graph, class ALGEBRA>
+void Dijkstra<Graph,ALGEBRA>::resetCacheStatistics ()
+{
+  hits_ = 0;
+  misses_ = 0;
+}
+
 } // namespace gl::algorithm  
 
 #endif // GL_DIJKSTRA_HPP
\ No newline at end of file
@@ -2,6 +2,13 @@
 #define GL_FLOYD_WARSHALL_HPP
 
 #include "../gl_base.hpp"
+#include "../gl_parallel.hpp"
+#include "../structures/AdjacencyArray.hpp"
+#include "../structures/IndexedDaryHeap.hpp"
+#include "../structures/ShortestPathTree.hpp"
+
+#include <algorithm>
+#include <type_traits>
 
 namespace gl {
 namespace algorithm {
@@ -11,6 +18,13 @@ namespace algorithm {
 ///////////////////////////////////////////////////////////
 
 /** 
+ * The distances are kept in a flat array in which unreachable pairs hold a sentinel value, so that every relaxation of
+ * a row is a branch-free loop over contiguous memory that the compiler can vectorize. For every intermediate node k,
+ * the rows are relaxed in parallel on graphs with at least parallelThreshold nodes.
+ * The intermediate nodes are processed in the same order as by the textbook algorithm, so distances and paths do not depend
+ * on the number of threads. On integer graphs, finite distances have to be smaller than GL_INF(val_t)/2.
+ * The tables are a snapshot of the graph: after modifying the graph, update() repairs them incrementally instead of
+ * recomputing them from scratch.
  * @class FloydWarshall
  * @brief Class computes that Shortest Paths for all pairs of nodes in the graph using the Floyd-Warshall algorithm.
  */
@@ -18,13 +32,16 @@ template <class Graph>
 class FloydWarshall {
   using idx_t = typename Graph::idx_t;
   using val_t = typename Graph::val_t;
-  using distance_matrix_t = std::vector<Distance<val_t>>;
+  using distance_matrix_t = std::vector<val_t>;
   using idx_list_t = typename Graph::idx_list_t;
+  using arc_list_t = typename Graph::edge_change_list_t;
 
 public:
 
-  FloydWarshall();                                               ///< @brief Default constructor
-  explicit FloydWarshall(const Graph& graph);                    ///< @brief Computation Constructor
+  FloydWarshall();                                                                      ///< @brief Default constructor
+  explicit FloydWarshall(const Graph& graph, unsigned numThreads = 0);                  ///< @brief Computation Constructor (graph has to outlive the object)
+  explicit FloydWarshall(Graph&& graph, unsigned numThreads = 0);                       ///< @brief Computation Constructor (takes ownership of the graph)
+  explicit FloydWarshall(const SharedGraph<Graph>& graph, unsigned numThreads = 0);     ///< @brief Computation Constructor (shares ownership of the graph)
 
   FloydWarshall(const FloydWarshall &) = default;                ///< Copy constructor
   FloydWarshall(FloydWarshall &&) noexcept = default;            ///< Move constructor
@@ -34,9 +51,31 @@ public:
 
   /**
    * @brief Computation. This is where the shortest distances and the successors of each node pair gets computed.
+   * @param graph Input graph on which the shortest paths will be computed. It is not copied and has to outlive the object.
+   * @param numThreads Number of threads relaxing the rows, 0 uses all hardware threads.
+   */
+  void compute(const Graph& graph, unsigned numThreads = 0);
+  /**
+   * @brief Computation on a temporary graph, whose ownership is taken over.
    * @param graph Input graph on which the shortest paths will be computed.
+   * @param numThreads Number of threads relaxing the rows, 0 uses all hardware threads.
+   */
+  void compute(Graph&& graph, unsigned numThreads = 0);
+  /**
+   * @brief Computation on a shared graph.
+   * @param graph Handle to the input graph on which the shortest paths will be computed.
+   * @param numThreads Number of threads relaxing the rows, 0 uses all hardware threads.
+   */
+  void compute(const SharedGraph<Graph>& graph, unsigned numThreads = 0);
+  /**
+   * Inserted edges and weight decreases are applied by relaxing all pairs through the edge, which takes O(n^2).
+   * For weight increases and deletions, only the pairs whose shortest path used the edge are recomputed, by a search
+   * over the affected nodes of every target. Everything else, i.e. modifications that are no longer in the change log
+   * of the graph, a changed number of nodes, negative cycles, leads to a full recomputation.
+   * @brief Brings the distances and paths up to date with the edge modifications of the graph since the last compute() or update().
+   * @return true if the tables were repaired incrementally, false if they were recomputed.
    */
-  void compute(const Graph& graph);
+  bool update();
   /**
    * @brief Checks whether the input graph has negative cycles.
    * @return True for negative cycle / false for none.
@@ -57,6 +96,14 @@ public:
    */
   std::pair<bool,idx_list_t> getPath(const idx_t src, const idx_t dest) const;
   /**
+   * The parent of a node is its predecessor on getPath(src, node). O(n * path length), no graph is built.
+   * @brief Returns the SPT (Shortest Path Tree) starting at 'src' as a view over a predecessor array.
+   * @param[in] src source node of the SPT.
+   * @return SPT view.
+   */
+  ShortestPathTree<Graph> getShortestPathTree (const idx_t src) const;
+  /**
+   * Materializes getShortestPathTree(src) as a Graph. Prefer the view unless a Graph is really needed.
    * @brief Returns a graph that only contains the edges of the SPT (Shortest Path Tree) starting at 'src'.
    * @param[in] src source node of SPT graph.
    * @return SPT Graph.
@@ -77,12 +124,39 @@ public:
   double harmonicCentrality (const idx_t id) const;
 
 
+  static constexpr idx_t parallelThreshold = 256; ///< @brief Smallest number of nodes for which the rows are relaxed in parallel
+
 private:
+  /**
+   * @brief Sentinel of unreachable pairs in the distance array. Half the largest value for integers, so that adding an edge weight cannot overflow.
+   */
+  static constexpr val_t infinity_ = std::is_integral_v<val_t> ? GL_INF(val_t) / 2 : GL_INF(val_t);
+
+  /**
+   * Relaxes the entries [begin, end) of row i over the intermediate node k. Written without branches so that it is vectorized.
+   * @brief Sets dist(i,j) = dist(i,k) + dist(k,j) and next(i,j) = next(i,k) wherever this is shorter.
+   */
+  static void relaxRow(val_t* rowI, idx_t* nextI, const val_t* rowK, const val_t ik, const idx_t nextIK, const idx_t begin, const idx_t end);
+  /**
+   * @brief Relaxes all pairs through the edge start->end. O(n^2).
+   * @return false if the edge closes a negative cycle, in which case nothing is changed.
+   */
+  bool insertArc(const idx_t start, const idx_t end, const val_t weight);
+  /**
+   * Runs independently for every target j: the nodes whose successor chain towards j crosses a removed edge are reset and
+   * recomputed by a backward Dijkstra over the remaining edges, keyed by the increase over the old distance, which is non-negative.
+   * @brief Updates the tables to the graph without the given edges.
+   * @param[in] removed Sorted list of edges that are ignored.
+   */
+  void removeArcs(const arc_list_t& removed);
+
   bool isInitialized_ = false;         ///< @brief Boolean storing initialization status
   std::pair<bool,idx_t> negativePath_; ///< @brief Boolean storing info on negative path in graph
-  Graph graph_;                        ///< @brief Reference to graph
-  distance_matrix_t dist_;             ///< @brief Shortest Path lengths
+  SharedGraph<Graph> graph_;           ///< @brief Reference to graph
+  distance_matrix_t dist_;             ///< @brief Shortest Path lengths, infinity_ for unreachable pairs
   idx_list_t next_;                    ///< @brief Shortest Path successors
+  typename Graph::generation_t generation_ = 0; ///< @brief Generation of the graph that the tables correspond to
+  unsigned numThreads_ = 1;            ///< @brief Number of threads used for computations and updates
 };
 
 ///////////////////////////////////////////////////////////
@@ -93,67 +167,300 @@ template <class Graph>
 FloydWarshall<Graph>::FloydWarshall() : isInitialized_(false), negativePath_(std::make_pair<bool,idx_t>(false,0)) {}
 
 template <class Graph>
-FloydWarshall<Graph>::FloydWarshall(const Graph& graph) : isInitialized_(false), negativePath_(std::make_pair<bool,idx_t>(false,0)) 
+FloydWarshall<Graph>::FloydWarshall(const Graph& graph, unsigned numThreads) : isInitialized_(false), negativePath_(std::make_pair<bool,idx_t>(false,0)) 
+{
+  compute(graph, numThreads);
+}
+
+template <class Graph>
+FloydWarshall<Graph>::FloydWarshall(Graph&& graph, unsigned numThreads) : isInitialized_(false), negativePath_(std::make_pair<bool,idx_t>(false,0)) 
+{
+  compute(std::move(graph), numThreads);
+}
+
+template <class Graph>
+FloydWarshall<Graph>::FloydWarshall(const SharedGraph<Graph>& graph, unsigned numThreads) : isInitialized_(false), negativePath_(std::make_pair<bool,idx_t>(false,0)) 
+{
+  compute(graph, numThreads);
+}
+
+template <class Graph>
+void FloydWarshall<Graph>::compute(const Graph& graph, unsigned numThreads)
+{
+  compute(SharedGraph<Graph>::view(graph), numThreads);
+}
+
+template <class Graph>
+void FloydWarshall<Graph>::compute(Graph&& graph, unsigned numThreads)
 {
-  compute(graph);
+  compute(SharedGraph<Graph>(std::move(graph)), numThreads);
 }
 
 template <class Graph>
-void FloydWarshall<Graph>::compute(const Graph& graph)
+void FloydWarshall<Graph>::relaxRow(val_t* rowI, idx_t* nextI, const val_t* rowK, const val_t ik, const idx_t nextIK, const idx_t begin, const idx_t end)
 {
-  idx_t i, j, k;
-  idx_t numNodes = graph.numNodes();
-  val_t weight;
-  distance_matrix_t dist (numNodes*numNodes);
+  for (idx_t j = begin; j < end; ++j)
+  {
+    const val_t kj = rowK[j];
+    const val_t ij = rowI[j];
+    const idx_t nextIJ = nextI[j];
+    const val_t candidate = ik + kj;
+    const bool shorter = (kj != infinity_) & (candidate < ij);
+    rowI[j] = shorter ? candidate : ij;
+    nextI[j] = shorter ? nextIK : nextIJ;
+  }
+}
+
+template <class Graph>
+void FloydWarshall<Graph>::compute(const SharedGraph<Graph>& handle, unsigned numThreads)
+{
+  const Graph& graph = *handle;
+  // check for negative weights in undirected graphs
+  GL_ASSERT(graph.isDirected() || graph.numNegativeEdges() == 0,"FloydWarshall::compute | Graph is undirected and contains negative weights")
+  const idx_t numNodes = graph.numNodes();
+  distance_matrix_t dist (numNodes*numNodes,infinity_);
   idx_list_t next (numNodes*numNodes,GL_INF(idx_t));
   // fill initial known edges
-  for (int i = 0; i < graph.numNodes(); ++i)
+  typename Graph::dest_vec_t neighbours;
+  for (idx_t i = 0; i < numNodes; ++i)
   {
-    for (int j = 0; j < graph.numNodes(); ++j)
+    graph.getNeighbourWeights(i,neighbours);
+    for (const auto& x : neighbours)
     {
-      if (!graph.hasEdge(i,j)) continue;
-      weight = graph.getEdgeWeight(i,j);
-      // check for negative weights in undirected graphs
-      if (!graph.isDirected()) 
-      {
-        GL_ASSERT(weight >= 0,"FloydWarshall::compute | Graph is undirected and contains negative weights")
-      }
-      dist[i*numNodes+j].setDistance(weight);
-      next[i*numNodes+j] = j;
+      dist[i*numNodes+x.first] = x.second;
+      next[i*numNodes+x.first] = x.first;
     }
   }
   // set diagonals
   for (idx_t i = 0; i < numNodes; ++i)
   {
-    dist[i*numNodes+i].setDistance(0);
+    dist[i*numNodes+i] = val_t(0);
     next[i*numNodes+i] = i;
   }
-  // Actual Floyd-Warshall Algorithm
-  for (k = 0; k < numNodes; ++k) {
-    for (j = 0; j < numNodes; ++j) {
-      for (i = 0; i < numNodes; ++i) {
-        if (k == i || k == j) 
-          continue;
-        if (dist[i*numNodes+k] + dist[k*numNodes+j] < dist[i*numNodes+j])
-        {
-          dist[i*numNodes+j] = dist[i*numNodes+k] + dist[k*numNodes+j];
-          next[i*numNodes+j] = next[i*numNodes+k];
-        }
+  // Actual Floyd-Warshall Algorithm: row k and column k do not change while k is the intermediate node,
+  // so the rows are independent and each one is a contiguous, vectorizable loop
+  numThreads = resolveThreads(numThreads);
+  const unsigned rowThreads = numNodes >= parallelThreshold ? numThreads : 1;
+  for (idx_t k = 0; k < numNodes; ++k) {
+    const val_t* rowK = dist.data() + k*numNodes;
+    parallelFor(numNodes, rowThreads, [&](const std::size_t i, const unsigned) {
+      const val_t ik = dist[i*numNodes+k];
+      if (i == k || ik == infinity_)
+        return;
+      val_t* rowI = dist.data() + i*numNodes;
+      idx_t* nextI = next.data() + i*numNodes;
+      relaxRow(rowI, nextI, rowK, ik, nextI[k], 0, k);
+      relaxRow(rowI, nextI, rowK, ik, nextI[k], k+1, numNodes);
+    });
+  }
+  // Check for negative cycles, which can only exist if there are negative edges
+  negativePath_ = {false,0};
+  if (graph.numNegativeEdges() > 0)
+  {
+    for (idx_t i = 0; i < numNodes; ++i)
+    {
+      if (dist[i*numNodes+i] != val_t(0)) 
+      {
+        negativePath_ = {true,i};
       }
     }
   }
-  // Check for negative cycles
-  for (idx_t i = 0; i < numNodes; ++i)
+  dist_ = std::move(dist);
+  graph_ = handle;
+  next_ = std::move(next);
+  generation_ = graph.generation();
+  numThreads_ = numThreads;
+  isInitialized_ = true;
+}
+
+template <class Graph>
+bool FloydWarshall<Graph>::update()
+{
+  GL_ASSERT(isInitialized_,"FloydWarshall::update | FloydWarshall has not been initialized with a graph.")
+  const Graph& graph = *graph_;
+  if (generation_ == graph.generation())
+    return true;
+  const idx_t numNodes = graph.numNodes();
+  auto changes = graph.getEdgeChangesSince(generation_);
+  if (!changes.first || dist_.size() != numNodes*numNodes || negativePath_.first)
+  {
+    compute(graph_, numThreads_);
+    return false;
+  }
+  GL_ASSERT(graph.isDirected() || graph.numNegativeEdges() == 0,"FloydWarshall::update | Graph is undirected and contains negative weights")
+
+  // changed edges in both orientations for undirected graphs, self-loops are never part of a shortest path
+  arc_list_t arcs;
+  for (const auto& change : changes.second)
+  {
+    if (change.first == change.second) continue;
+    arcs.push_back(change);
+    if (graph.isUndirected())
+      arcs.emplace_back(change.second, change.first);
+  }
+  std::sort(arcs.begin(), arcs.end());
+  arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+
+  // an edge that is at most as heavy as the current distance between its end points has been inserted or decreased,
+  // which is the same as adding a parallel edge. All other changes may have made paths longer.
+  arc_list_t decreased, removed;
+  for (const auto& arc : arcs)
+  {
+    const bool present = graph.hasEdge(arc.first, arc.second);
+    if (present && !(dist_[arc.first*numNodes+arc.second] < graph.getEdgeWeight(arc.first, arc.second)))
+      decreased.push_back(arc);
+    else
+      removed.push_back(arc);
+  }
+  for (const auto& arc : decreased)
   {
-    if (!dist[i*numNodes+i].isZero()) 
+    if (!insertArc(arc.first, arc.second, graph.getEdgeWeight(arc.first, arc.second)))
     {
-      negativePath_ = {true,i};
+      compute(graph_, numThreads_);
+      return false;
     }
   }
-  dist_ = dist;
-  graph_ = graph;
-  next_ = next;
-  isInitialized_ = true;
+  // remove the edges that may have become heavier, then insert them again with their current weight
+  if (!removed.empty())
+  {
+    removeArcs(removed);
+    for (const auto& arc : removed)
+    {
+      if (graph.hasEdge(arc.first, arc.second) && !insertArc(arc.first, arc.second, graph.getEdgeWeight(arc.first, arc.second)))
+      {
+        compute(graph_, numThreads_);
+        return false;
+      }
+    }
+  }
+  generation_ = graph.generation();
+  return true;
+}
+
+template <class Graph>
+bool FloydWarshall<Graph>::insertArc(const idx_t start, const idx_t end, const val_t weight)
+{
+  const idx_t numNodes = graph_->numNodes();
+  // no pair can get shorter if the edge is not shorter than the current path
+  if (!(weight < dist_[start*numNodes+end]))
+    return true;
+  const val_t back = dist_[end*numNodes+start];
+  if (back != infinity_ && weight + back < val_t(0))
+    return false;
+  // row 'end' does not change, since a shorter path from 'end' through the edge would close a negative cycle
+  const distance_matrix_t rowEnd(dist_.begin() + end*numNodes, dist_.begin() + (end+1)*numNodes);
+  const unsigned numThreads = numNodes >= parallelThreshold ? numThreads_ : 1;
+  parallelFor(numNodes, numThreads, [&](const std::size_t i, const unsigned) {
+    const val_t toStart = dist_[i*numNodes+start];
+    if (toStart == infinity_)
+      return;
+    const idx_t nextIK = i == start ? end : next_[i*numNodes+start];
+    relaxRow(dist_.data() + i*numNodes, next_.data() + i*numNodes, rowEnd.data(), toStart + weight, nextIK, 0, numNodes);
+  });
+  return true;
+}
+
+template <class Graph>
+void FloydWarshall<Graph>::removeArcs(const arc_list_t& removed)
+{
+  const idx_t numNodes = graph_->numNodes();
+  const AdjacencyArray<val_t> out(*graph_);
+  const AdjacencyArray<val_t> in(*graph_, true);
+  auto isRemoved = [&removed](const idx_t start, const idx_t end) {
+    return std::binary_search(removed.begin(), removed.end(), std::make_pair(start, end));
+  };
+  enum : unsigned char { UNKNOWN, AFFECTED, UNAFFECTED, SETTLED };
+  struct Workspace {
+    std::vector<unsigned char> state;
+    idx_list_t chain, affected, estimateNext;
+    distance_matrix_t oldDistance, estimate;
+    IndexedDaryHeap<val_t> heap;
+  };
+  const unsigned numThreads = numNodes >= parallelThreshold ? numThreads_ : 1;
+  std::vector<Workspace> workspaces(numThreads);
+
+  parallelFor(numNodes, numThreads, [&](const std::size_t j, const unsigned thread) {
+    // only targets whose paths leave some start node through a removed edge are affected
+    bool touched = false;
+    for (auto arc = removed.begin(); !touched && arc != removed.end(); ++arc)
+      touched = arc->first != j && dist_[arc->first*numNodes+j] != infinity_ && next_[arc->first*numNodes+j] == arc->second;
+    if (!touched)
+      return;
+
+    Workspace& w = workspaces[thread];
+    if (w.state.size() != numNodes)
+    {
+      w.oldDistance.resize(numNodes);
+      w.estimate.resize(numNodes);
+      w.estimateNext.resize(numNodes);
+      w.heap.resize(numNodes);
+    }
+    w.state.assign(numNodes, UNKNOWN);
+    w.affected.clear();
+    // a node is affected if its successor chain towards j crosses a removed edge
+    for (idx_t i = 0; i < numNodes; ++i)
+    {
+      w.chain.clear();
+      idx_t x = i;
+      unsigned char result;
+      while (true)
+      {
+        if (w.state[x] != UNKNOWN) { result = w.state[x]; break; }
+        if (x == j || dist_[x*numNodes+j] == infinity_) { result = UNAFFECTED; break; }
+        const idx_t successor = next_[x*numNodes+j];
+        w.chain.push_back(x);
+        if (isRemoved(x, successor)) { result = AFFECTED; break; }
+        x = successor;
+      }
+      for (auto y : w.chain)
+        w.state[y] = result;
+      if (w.state[x] == UNKNOWN)
+        w.state[x] = result;
+    }
+    for (idx_t i = 0; i < numNodes; ++i)
+    {
+      if (w.state[i] != AFFECTED) continue;
+      w.affected.push_back(i);
+      w.oldDistance[i] = dist_[i*numNodes+j];
+      dist_[i*numNodes+j] = infinity_;
+      next_[i*numNodes+j] = GL_INF(idx_t);
+    }
+    // initial estimates through unaffected neighbours
+    w.heap.clear();
+    for (auto a : w.affected)
+    {
+      w.estimate[a] = infinity_;
+      for (idx_t e = out.begin(a); e < out.end(a); ++e)
+      {
+        const idx_t x = out.target(e);
+        if (w.state[x] == AFFECTED || dist_[x*numNodes+j] == infinity_ || isRemoved(a, x)) continue;
+        const val_t candidate = out.weight(e) + dist_[x*numNodes+j];
+        if (candidate < w.estimate[a]) { w.estimate[a] = candidate; w.estimateNext[a] = x; }
+      }
+      if (w.estimate[a] != infinity_)
+        w.heap.push(a, w.estimate[a] - w.oldDistance[a]);
+    }
+    // backward Dijkstra over the affected nodes
+    while (!w.heap.empty())
+    {
+      const idx_t a = w.heap.pop().second;
+      w.state[a] = SETTLED;
+      dist_[a*numNodes+j] = w.estimate[a];
+      next_[a*numNodes+j] = w.estimateNext[a];
+      for (idx_t e = in.begin(a); e < in.end(a); ++e)
+      {
+        const idx_t y = in.target(e);
+        if (w.state[y] != AFFECTED || isRemoved(y, a)) continue;
+        const val_t candidate = in.weight(e) + w.estimate[a];
+        if (candidate < w.estimate[y])
+        {
+          w.estimate[y] = candidate;
+          w.estimateNext[y] = a;
+          w.heap.pushOrDecrease(y, candidate - w.oldDistance[y]);
+        }
+      }
+    }
+  }, 1);
 }
 
 template <class Graph>
@@ -166,20 +473,21 @@ bool FloydWarshall<Graph>::hasNegativePath () const {
 template <class Graph>
 Distance<typename Graph::val_t> FloydWarshall<Graph>::pathLength (const idx_t src, const idx_t dest) const {
   GL_ASSERT(isInitialized_,"FloydWarshall::pathLength | FloydWarshall has not been initialized with a graph.")
-  graph_.checkRange(src,dest);
+  graph_->checkRange(src,dest);
   GL_ASSERT(!negativePath_.first,std::string("FloydWarshall::pathLength | The input graph has a negative cycle at node ")+std::to_string(negativePath_.second))
   
-  return dist_[src*graph_.numNodes()+dest];
+  const val_t distance = dist_[src*graph_->numNodes()+dest];
+  return distance == infinity_ ? Distance<val_t>() : Distance<val_t>(distance);
 }
 
 template <class Graph>
 std::pair<bool,typename Graph::idx_list_t> FloydWarshall<Graph>::getPath (const idx_t src, const idx_t dest) const {
   GL_ASSERT(isInitialized_,"FloydWarshall::getPath | FloydWarshall has not been initialized with a graph.")
-  graph_.checkRange(src,dest);
+  graph_->checkRange(src,dest);
   GL_ASSERT(!negativePath_.first,std::string("FloydWarshall::getPath | The input graph has a negative cycle at node ")+std::to_string(negativePath_.second))
 
   // Check for path existance
-  if (dist_[src*graph_.numNodes()+dest].isInfinite())
+  if (dist_[src*graph_->numNodes()+dest] == infinity_)
     return {false,{}};
 
   // backtracking
@@ -187,48 +495,54 @@ std::pair<bool,typename Graph::idx_list_t> FloydWarshall<Graph>::getPath (const
   out.push_back(src);
   idx_t u = src;
   while (u != dest) {
-    u = next_[u*graph_.numNodes()+dest];
+    u = next_[u*graph_->numNodes()+dest];
     out.push_back(u);
   }
   return {true,out};
 }
 
 template <class Graph>
-Graph FloydWarshall<Graph>::getSPT (const idx_t src) const
+ShortestPathTree<Graph> FloydWarshall<Graph>::getShortestPathTree (const idx_t src) const
 {
-  GL_ASSERT(isInitialized_,"FloydWarshall::getSPT | FloydWarshall has not been initialized with a graph.")
-  graph_.checkRange(src);
-  GL_ASSERT(!negativePath_.first,std::string("FloydWarshall::getSPT | The input graph has a negative cycle at node ")+std::to_string(negativePath_.second))
+  GL_ASSERT(isInitialized_,"FloydWarshall::getShortestPathTree | FloydWarshall has not been initialized with a graph.")
+  graph_->checkRange(src);
+  GL_ASSERT(!negativePath_.first,std::string("FloydWarshall::getShortestPathTree | The input graph has a negative cycle at node ")+std::to_string(negativePath_.second))
 
-  Graph result(graph_.numNodes(),std::string(std::string("SPT of node ")+std::to_string(src)+std::string(" in ")+graph_.getGraphLabel()));
-  for (idx_t i = 0; i < graph_.numNodes(); ++i)
+  const idx_t numNodes = graph_->numNodes();
+  std::vector<idx_t> parents(numNodes);
+  for (idx_t v = 0; v < numNodes; ++v)
   {
-    auto path = getPath(src,i);
-    if (path.first) {
-      idx_t i = 0;
-      for (idx_t j = i+1; j < path.second.size(); ++i, ++j)
-      {
-        if (!result.hasEdge(path.second[i],path.second[j])) 
-        {
-          result.setEdge(path.second[i],path.second[j],graph_.getEdgeWeight(path.second[i],path.second[j]));
-        }
-      }
-    }
+    parents[v] = v;
+    if (v == src || dist_[src*numNodes+v] == infinity_) continue;
+    // follow the successors from src until the last node before v
+    idx_t u = src;
+    while (next_[u*numNodes+v] != v)
+      u = next_[u*numNodes+v];
+    parents[v] = u;
   }
-  return result;
+  return ShortestPathTree<Graph>(graph_, src, std::move(parents));
+}
+
+template <class Graph>
+Graph FloydWarshall<Graph>::getSPT (const idx_t src) const
+{
+  GL_ASSERT(isInitialized_,"FloydWarshall::getSPT | FloydWarshall has not been initialized with a graph.")
+  graph_->checkRange(src);
+  GL_ASSERT(!negativePath_.first,std::string("FloydWarshall::getSPT | The input graph has a negative cycle at node ")+std::to_string(negativePath_.second))
+  return getShortestPathTree(src).toGraph();
 }
 
 template <class Graph>
 double FloydWarshall<Graph>::closenessCentrality (const idx_t id) const
 {
   GL_ASSERT(isInitialized_,"FloydWarshall::closenessCentrality | FloydWarshall has not been initialized with a graph.")
-  graph_.checkRange(id);
+  graph_->checkRange(id);
   GL_ASSERT(!negativePath_.first,std::string("FloydWarshall::closenessCentrality | The input graph has a negative cycle at node ")+std::to_string(negativePath_.second))
 
   double result = 0;
   Distance<typename Graph::val_t> distance;
 
-  for (idx_t i = 0; i < graph_.numNodes(); ++i)
+  for (idx_t i = 0; i < graph_->numNodes(); ++i)
   {
     if (id == i) continue;
     distance = pathLength(i,id);
@@ -237,20 +551,20 @@ double FloydWarshall<Graph>::closenessCentrality (const idx_t id) const
     else
       result += distance.scalarDistance();
   }
-  return static_cast<double>((graph_.numNodes()-1)/result);
+  return static_cast<double>((graph_->numNodes()-1)/result);
 }
 
 template <class Graph>
 double FloydWarshall<Graph>::harmonicCentrality (const idx_t id) const
 {
   GL_ASSERT(isInitialized_,"FloydWarshall::closenessCentrality | FloydWarshall has not been initialized with a graph.")
-  graph_.checkRange(id);
+  graph_->checkRange(id);
   GL_ASSERT(!negativePath_.first,std::string("FloydWarshall::closenessCentrality | The input graph has a negative cycle at node ")+std::to_string(negativePath_.second))
 
   double result = 0;
   Distance<typename Graph::val_t> distance;
 
-  for (idx_t i = 0; i < graph_.numNodes(); ++i)
+  for (idx_t i = 0; i < graph_->numNodes(); ++i)
   {
     if (id == i) continue;
     distance = pathLength(i,id);
@@ -259,7 +573,7 @@ double FloydWarshall<Graph>::harmonicCentrality (const idx_t id) const
     else
       result += 1./distance.scalarDistance();
   }
-  return static_cast<double>(result/(graph_.numNodes()-1));
+  return static_cast<double>(result/(graph_->numNodes()-1));
 }
 
 } // namespace algorithm  
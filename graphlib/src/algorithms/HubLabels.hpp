@@ -0,0 +1,281 @@
+#ifndef GL_HUB_LABELS_HPP
+#define GL_HUB_LABELS_HPP
+
+#include "../gl_base.hpp"
+#include "../structures/AdjacencyArray.hpp"
+#include "../structures/SearchWorkspace.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace gl::algorithm {
+
+///////////////////////////////////////////////////////////
+//    Class declaration
+///////////////////////////////////////////////////////////
+
+/**
+ * Every node stores a label of (hub, distance) pairs such that each shortest path s->t passes through a hub that appears
+ * in the forward label of s and in the backward label of t (2-hop cover). The labels are built with pruned landmark labeling:
+ * one Dijkstra search per node in the given order, which stops at nodes whose distance is already covered by the labels so far.
+ * Important nodes should come first; the default order is by decreasing degree.
+ *
+ * The labels are stored in flat arrays sorted by hub rank and terminated by a sentinel, so a query is a branch-light
+ * merge of two contiguous arrays. Only distances are available, no paths.
+ * The labels are a snapshot: they do not observe later modifications of the graph.
+ * @class HubLabels
+ * @brief Exact distance oracle based on hub labels.
+ */
+template <class Graph>
+class HubLabels {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+  /**
+   * @brief Builds the labels using the nodes in order of decreasing degree as hubs.
+   * @param[in] graph Graph with positive edge weights
+   */
+  explicit HubLabels(const Graph& graph);
+  /**
+   * @brief Builds the labels using the given node order (e.g. the reversed contraction order of a hierarchy).
+   * @param[in] graph Graph with positive edge weights
+   * @param[in] order Permutation of the nodes, most important first
+   */
+  HubLabels(const Graph& graph, const idx_list_t& order);
+
+  HubLabels() = default;                                    ///< Default constructor
+  HubLabels(const HubLabels &) = default;                   ///< Copy constructor
+  HubLabels(HubLabels &&) noexcept = default;               ///< Move constructor
+  HubLabels &operator=(const HubLabels &) = default;        ///< Copy assignment
+  HubLabels &operator=(HubLabels &&) noexcept = default;    ///< Move assignment
+  ~HubLabels() = default;                                   ///< Default destructor
+
+  /**
+   * @brief Computes the length of the shortest path from src to dest.
+   * @param[in] src Start of shortest path
+   * @param[in] dest End of shortest path
+   * @return Length of the shortest path, infinite if dest is unreachable.
+   */
+  Distance<val_t> pathLength(const idx_t src, const idx_t dest) const;
+  /**
+   * @brief Number of nodes of the labeled graph.
+   * @return Number of nodes.
+   */
+  idx_t numNodes() const { return forward_.offsets.empty() ? 0 : forward_.offsets.size() - 1; }
+  /**
+   * @brief Total number of label entries (forward and backward labels of directed graphs are counted separately).
+   * @return Number of (hub, distance) pairs.
+   */
+  idx_t numEntries() const;
+  /**
+   * @brief Average number of entries in the forward label of a node.
+   * @return Average label size.
+   */
+  double averageLabelSize() const;
+  /**
+   * @brief Memory used by the labels.
+   * @return Size of the label arrays in bytes.
+   */
+  std::size_t memoryUsage() const;
+
+private:
+  /**
+   * @brief Labels of all nodes in flat arrays.
+   */
+  struct Labels {
+    std::vector<idx_t> offsets;   ///< @brief Label of node u is [offsets[u], offsets[u+1]), including the sentinel
+    std::vector<idx_t> hubs;      ///< @brief Hub ranks, increasing within a label, GL_INF terminates a label
+    std::vector<val_t> distances; ///< @brief Distance to (forward) or from (backward) the hub
+  };
+
+  /**
+   * @brief Runs the pruned searches in the given order and flattens the labels.
+   */
+  void build(const Graph& graph, const idx_list_t& order);
+  /**
+   * @brief Converts per node labels into flat arrays with sentinels.
+   */
+  static Labels flatten(std::vector<std::vector<std::pair<idx_t,val_t>>>& labels);
+  /**
+   * @brief Merges two labels.
+   * @return true and the smallest distance sum over common hubs, false if there is none.
+   */
+  static std::pair<bool,val_t> merge(const Labels& out, const idx_t src, const Labels& in, const idx_t dest);
+
+  Labels forward_;         ///< @brief Hubs reachable from a node, with distances from the node
+  Labels backward_;        ///< @brief Hubs that reach a node, with distances to the node (empty for undirected graphs)
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+HubLabels<Graph>::HubLabels(const Graph& graph)
+{
+  idx_list_t order(graph.numNodes());
+  for (idx_t u = 0; u < order.size(); ++u)
+    order[u] = u;
+  std::stable_sort(order.begin(), order.end(), [&graph](idx_t lhs, idx_t rhs) {
+    return graph.getNodeInDegree(lhs) + graph.getNodeOutDegree(lhs) > graph.getNodeInDegree(rhs) + graph.getNodeOutDegree(rhs);
+  });
+  build(graph, order);
+}
+
+template <class Graph>
+HubLabels<Graph>::HubLabels(const Graph& graph, const idx_list_t& order)
+{
+  build(graph, order);
+}
+
+template <class Graph>
+void HubLabels<Graph>::build(const Graph& graph, const idx_list_t& order)
+{
+  GL_ASSERT(graph.numNonPositiveEdges() == 0, "HubLabels::build | Found non-positive edge weights in the graph.");
+  const idx_t n = graph.numNodes();
+  std::vector<char> seen(n, 0);
+  for (auto u : order) {
+    graph.checkRange(u);
+    seen[u] = 1;
+  }
+  GL_ASSERT(order.size() == n && std::count(seen.begin(), seen.end(), 1) == std::ptrdiff_t(n),
+            "HubLabels::build | The order is not a permutation of the nodes.");
+
+  const bool directed = graph.isDirected();
+  AdjacencyArray<val_t> outgoing(graph), incoming;
+  if (directed) incoming = AdjacencyArray<val_t>(graph, true);
+
+  // labels under construction: (hub rank, distance), appended in increasing rank order
+  std::vector<std::vector<std::pair<idx_t,val_t>>> outLabels(n), inLabels(directed ? n : 0);
+  auto& targetLabels = directed ? inLabels : outLabels;
+  std::vector<val_t> hubDistance(n, GL_INF(val_t)); // label of the current hub, indexed by rank
+  SearchWorkspace<val_t> workspace(n);
+
+  // searches from the hub in direction of the edges fill the labels of the reached nodes; covered nodes are pruned
+  auto prunedSearch = [&](const idx_t rank, const AdjacencyArray<val_t>& edges,
+                          const std::vector<std::pair<idx_t,val_t>>& hubLabel, std::vector<std::vector<std::pair<idx_t,val_t>>>& reached) {
+    const idx_t hub = order[rank];
+    for (const auto& entry : hubLabel)
+      hubDistance[entry.first] = entry.second;
+    workspace.reset();
+    workspace.relax(hub, val_t(0), hub);
+    while (!workspace.empty()) {
+      auto top = workspace.pop();
+      idx_t v = top.second;
+      if (workspace.isSettled(v)) continue;
+      workspace.settle(v);
+      bool covered = false;
+      for (const auto& entry : reached[v])
+        if (hubDistance[entry.first] != GL_INF(val_t) && !(top.first < hubDistance[entry.first] + entry.second)) {
+          covered = true;
+          break;
+        }
+      if (covered) continue;
+      reached[v].emplace_back(rank, top.first);
+      for (idx_t e = edges.begin(v); e < edges.end(v); ++e)
+        workspace.relax(edges.target(e), top.first + edges.weight(e), v);
+    }
+    for (const auto& entry : hubLabel)
+      hubDistance[entry.first] = GL_INF(val_t);
+  };
+
+  for (idx_t rank = 0; rank < n; ++rank) {
+    // forward search: distances from the hub, stored in the backward labels; the hub's forward label prunes
+    prunedSearch(rank, outgoing, outLabels[order[rank]], targetLabels);
+    // backward search: distances to the hub, stored in the forward labels
+    if (directed)
+      prunedSearch(rank, incoming, inLabels[order[rank]], outLabels);
+  }
+
+  forward_ = flatten(outLabels);
+  if (directed)
+    backward_ = flatten(inLabels);
+  else
+    backward_ = Labels();
+}
+
+template <class Graph>
+typename HubLabels<Graph>::Labels HubLabels<Graph>::flatten(std::vector<std::vector<std::pair<idx_t,val_t>>>& labels)
+{
+  Labels flat;
+  flat.offsets.reserve(labels.size() + 1);
+  flat.offsets.push_back(0);
+  for (auto& label : labels) {
+    for (const auto& entry : label) {
+      flat.hubs.push_back(entry.first);
+      flat.distances.push_back(entry.second);
+    }
+    flat.hubs.push_back(GL_INF(idx_t));
+    flat.distances.push_back(val_t(0));
+    flat.offsets.push_back(flat.hubs.size());
+    std::vector<std::pair<idx_t,val_t>>().swap(label);
+  }
+  return flat;
+}
+
+template <class Graph>
+std::pair<bool,typename Graph::val_t> HubLabels<Graph>::merge(const Labels& out, const idx_t src, const Labels& in, const idx_t dest)
+{
+  const idx_t* lhs = out.hubs.data() + out.offsets[src];
+  const idx_t* rhs = in.hubs.data() + in.offsets[dest];
+  const val_t* lhsDistance = out.distances.data() + out.offsets[src];
+  const val_t* rhsDistance = in.distances.data() + in.offsets[dest];
+  bool found = false;
+  val_t best = 0;
+  idx_t i = 0, j = 0;
+  for (;;) {
+    idx_t a = lhs[i], b = rhs[j];
+    if (a == b) {
+      if (a == GL_INF(idx_t)) break;
+      val_t sum = lhsDistance[i] + rhsDistance[j];
+      if (!found || sum < best) best = sum;
+      found = true;
+    }
+    // the sentinels stop the merge without bounds checks
+    i += (a <= b);
+    j += (b <= a);
+  }
+  return {found, best};
+}
+
+template <class Graph>
+Distance<typename Graph::val_t> HubLabels<Graph>::pathLength(const idx_t src, const idx_t dest) const
+{
+  GL_ASSERT(src < numNodes() && dest < numNodes(), "HubLabels::pathLength | Node index out of range.");
+  auto result = merge(forward_, src, backward_.offsets.empty() ? forward_ : backward_, dest);
+  if (!result.first)
+    return Distance<val_t>();
+  return Distance<val_t>(result.second);
+}
+
+template <class Graph>
+typename HubLabels<Graph>::idx_t HubLabels<Graph>::numEntries() const
+{
+  // every label ends with a sentinel
+  idx_t entries = forward_.hubs.size() - numNodes();
+  if (!backward_.offsets.empty())
+    entries += backward_.hubs.size() - numNodes();
+  return entries;
+}
+
+template <class Graph>
+double HubLabels<Graph>::averageLabelSize() const
+{
+  if (numNodes() == 0) return 0.;
+  return double(forward_.hubs.size() - numNodes()) / numNodes();
+}
+
+template <class Graph>
+std::size_t HubLabels<Graph>::memoryUsage() const
+{
+  std::size_t bytes = 0;
+  for (const auto* labels : {&forward_, &backward_})
+    bytes += (labels->offsets.size() + labels->hubs.size()) * sizeof(idx_t) + labels->distances.size() * sizeof(val_t);
+  return bytes;
+}
+
+} // namespace gl::algorithm
+
+#endif // GL_HUB_LABELS_HPP
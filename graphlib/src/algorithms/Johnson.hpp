@@ -0,0 +1,309 @@
+#ifndef GL_JOHNSON_HPP
+#define GL_JOHNSON_HPP
+
+#include "../gl_base.hpp"
+#include "../gl_parallel.hpp"
+#include "../structures/AdjacencyArray.hpp"
+#include "../structures/SearchWorkspace.hpp"
+#include "../structures/ShortestPathTree.hpp"
+#include "BellmanFord.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace gl {
+namespace algorithm {
+
+///////////////////////////////////////////////////////////
+//    Class declaration
+///////////////////////////////////////////////////////////
+
+/**
+ * If the graph has negative edges, a BellmanFord (SPFA) search from a virtual source connected to every node computes a potential h
+ * such that the reduced weights w(u,v) + h(u) - h(v) are non-negative. Then one Dijkstra search per source runs on the reduced
+ * weights, in parallel, and the distances are shifted back. This takes O(n m log n) instead of the O(n^3) of FloydWarshall,
+ * which pays off on sparse graphs. The results are stored in n*n tables, like in FloydWarshall.
+ * Self-loops are ignored.
+ * @class Johnson
+ * @brief Computes the Shortest Paths for all pairs of nodes in the graph using Johnson's algorithm.
+ */
+template <class Graph>
+class Johnson {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using distance_matrix_t = std::vector<Distance<val_t>>;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+
+  Johnson();                                                                      ///< @brief Default constructor
+  explicit Johnson(const Graph& graph, unsigned numThreads = 0);                  ///< @brief Computation Constructor (graph has to outlive the object)
+  explicit Johnson(Graph&& graph, unsigned numThreads = 0);                       ///< @brief Computation Constructor (takes ownership of the graph)
+  explicit Johnson(const SharedGraph<Graph>& graph, unsigned numThreads = 0);     ///< @brief Computation Constructor (shares ownership of the graph)
+
+  Johnson(const Johnson &) = default;                ///< Copy constructor
+  Johnson(Johnson &&) noexcept = default;            ///< Move constructor
+  Johnson &operator=(const Johnson &) = default;     ///< Copy assignment
+  Johnson &operator=(Johnson &&) noexcept = default; ///< Move assignment
+  ~Johnson() = default;                              ///< Default destructor
+
+  /**
+   * @brief Computation. This is where the shortest distances and the predecessors of each node pair get computed.
+   * @param graph Input graph on which the shortest paths will be computed. It is not copied and has to outlive the object.
+   * @param numThreads Number of threads running the Dijkstra searches, 0 uses all hardware threads.
+   */
+  void compute(const Graph& graph, unsigned numThreads = 0);
+  /**
+   * @brief Computation on a temporary graph, whose ownership is taken over.
+   * @param graph Input graph on which the shortest paths will be computed.
+   * @param numThreads Number of threads running the Dijkstra searches, 0 uses all hardware threads.
+   */
+  void compute(Graph&& graph, unsigned numThreads = 0);
+  /**
+   * @brief Computation on a shared graph.
+   * @param graph Handle to the input graph on which the shortest paths will be computed.
+   * @param numThreads Number of threads running the Dijkstra searches, 0 uses all hardware threads.
+   */
+  void compute(const SharedGraph<Graph>& graph, unsigned numThreads = 0);
+  /**
+   * @brief Checks whether the input graph has negative cycles.
+   * @return True for negative cycle / false for none.
+   */
+  bool hasNegativePath () const;
+  /**
+   * @brief Computes the shortest path length from 'src' to 'dest'.
+   * @param src Starting point of shortest path.
+   * @param dest End point of shortest path.
+   * @return shortest path length / weight.
+   */
+  Distance<val_t> pathLength(const idx_t src, const idx_t dest) const;
+  /**
+   * @brief Computes the node sequence that represents the shortest path from 'src' to 'dest'.
+   * @param src Starting point of shortest path.
+   * @param dest End point of shortest path.
+   * @return boolean stating existance of a path & shortest path in form of an ordered list of node indices.
+   */
+  std::pair<bool,idx_list_t> getPath(const idx_t src, const idx_t dest) const;
+  /**
+   * @brief Returns the SPT (Shortest Path Tree) starting at 'src' as a view over a predecessor array. O(n).
+   * @param[in] src source node of the SPT.
+   * @return SPT view.
+   */
+  ShortestPathTree<Graph> getShortestPathTree (const idx_t src) const;
+  /**
+   * @brief Returns a graph that only contains the edges of the SPT (Shortest Path Tree) starting at 'src'.
+   * @param[in] src source node of SPT graph.
+   * @return SPT Graph.
+   */
+  Graph getSPT (const idx_t src) const;
+  /**
+   * @pre Connected graph
+   * @brief Computes the closeness centrality of node 'id'
+   * @param[in] id Node whose closeness centrality is to be computed
+   * @return closeness centrality of 'id'.
+   */
+  double closenessCentrality (const idx_t id) const;
+  /**
+   * @brief Computes the harmonic centrality of node 'id'
+   * @param[in] id Node whose harmonic centrality is to be computed
+   * @return harmonic centrality of 'id'.
+   */
+  double harmonicCentrality (const idx_t id) const;
+
+private:
+  /**
+   * @brief Asserts that the object is initialized, that the nodes exist and that there is no negative cycle.
+   */
+  void checkQuery(const char* method, const idx_t src, const idx_t dest) const;
+
+  bool isInitialized_ = false;         ///< @brief Boolean storing initialization status
+  std::pair<bool,idx_t> negativePath_; ///< @brief Boolean storing info on negative path in graph
+  SharedGraph<Graph> graph_;           ///< @brief Reference to graph
+  distance_matrix_t dist_;             ///< @brief Shortest Path lengths
+  idx_list_t pred_;                    ///< @brief Shortest Path predecessors, the node itself for the source and unreachable nodes
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+Johnson<Graph>::Johnson() : isInitialized_(false), negativePath_(std::make_pair<bool,idx_t>(false,0)) {}
+
+template <class Graph>
+Johnson<Graph>::Johnson(const Graph& graph, unsigned numThreads) : isInitialized_(false), negativePath_(std::make_pair<bool,idx_t>(false,0))
+{
+  compute(graph, numThreads);
+}
+
+template <class Graph>
+Johnson<Graph>::Johnson(Graph&& graph, unsigned numThreads) : isInitialized_(false), negativePath_(std::make_pair<bool,idx_t>(false,0))
+{
+  compute(std::move(graph), numThreads);
+}
+
+template <class Graph>
+Johnson<Graph>::Johnson(const SharedGraph<Graph>& graph, unsigned numThreads) : isInitialized_(false), negativePath_(std::make_pair<bool,idx_t>(false,0))
+{
+  compute(graph, numThreads);
+}
+
+template <class Graph>
+void Johnson<Graph>::compute(const Graph& graph, unsigned numThreads)
+{
+  compute(SharedGraph<Graph>::view(graph), numThreads);
+}
+
+template <class Graph>
+void Johnson<Graph>::compute(Graph&& graph, unsigned numThreads)
+{
+  compute(SharedGraph<Graph>(std::move(graph)), numThreads);
+}
+
+template <class Graph>
+void Johnson<Graph>::compute(const SharedGraph<Graph>& handle, unsigned numThreads)
+{
+  const Graph& graph = *handle;
+  GL_ASSERT(graph.isDirected() || graph.numNegativeEdges() == 0,"Johnson::compute | Graph is undirected and contains negative weights")
+  const idx_t n = graph.numNodes();
+  AdjacencyArray<val_t> edges(graph);
+
+  // reduced weights w(u,v) + h(u) - h(v) are non-negative (up to rounding, which is clamped)
+  std::vector<val_t> potential(n, val_t(0));
+  negativePath_ = {false,0};
+  if (graph.numNegativeEdges() > 0)
+    negativePath_ = BellmanFord<Graph>(handle).computePotential(potential);
+  graph_ = handle;
+  isInitialized_ = true;
+  if (negativePath_.first) {
+    distance_matrix_t().swap(dist_);
+    idx_list_t().swap(pred_);
+    return;
+  }
+  std::vector<val_t> reduced(edges.numEdges());
+  for (idx_t u = 0; u < n; ++u)
+    for (idx_t e = edges.begin(u); e < edges.end(u); ++e)
+      reduced[e] = std::max(val_t(0), val_t(edges.weight(e) + potential[u] - potential[edges.target(e)]));
+
+  distance_matrix_t dist(n*n);
+  idx_list_t pred(n*n);
+  numThreads = resolveThreads(numThreads);
+  std::vector<SearchWorkspace<val_t>> workspaces(numThreads);
+  parallelFor(n, numThreads, [&](const std::size_t i, const unsigned thread) {
+    const idx_t src = i;
+    auto& workspace = workspaces[thread];
+    if (workspace.size() != n) workspace.resize(n);
+    else workspace.reset();
+    Distance<val_t>* row = dist.data() + src*n;
+    idx_t* parent = pred.data() + src*n;
+    for (idx_t v = 0; v < n; ++v)
+      parent[v] = v;
+
+    workspace.relax(src, val_t(0), src);
+    while (!workspace.empty()) {
+      auto top = workspace.pop();
+      idx_t u = top.second;
+      if (workspace.isSettled(u) || top.first > workspace.distance(u)) continue;
+      workspace.settle(u);
+      row[u].setDistance(top.first - potential[src] + potential[u]);
+      parent[u] = workspace.predecessor(u);
+      for (idx_t e = edges.begin(u); e < edges.end(u); ++e)
+        workspace.relax(edges.target(e), top.first + reduced[e], u);
+    }
+  }, 1);
+  dist_ = std::move(dist);
+  pred_ = std::move(pred);
+}
+
+template <class Graph>
+void Johnson<Graph>::checkQuery(const char* method, const idx_t src, const idx_t dest) const
+{
+  GL_ASSERT(isInitialized_,std::string("Johnson::") + method + std::string(" | Johnson has not been initialized with a graph."))
+  graph_->checkRange(src,dest);
+  GL_ASSERT(!negativePath_.first,std::string("Johnson::") + method + std::string(" | The input graph has a negative cycle at node ")+std::to_string(negativePath_.second))
+}
+
+template <class Graph>
+bool Johnson<Graph>::hasNegativePath () const {
+  GL_ASSERT(isInitialized_,"Johnson::hasNegativePath | Johnson has not been initialized with a graph.")
+
+  return negativePath_.first;
+}
+
+template <class Graph>
+Distance<typename Graph::val_t> Johnson<Graph>::pathLength (const idx_t src, const idx_t dest) const {
+  checkQuery("pathLength", src, dest);
+  return dist_[src*graph_->numNodes()+dest];
+}
+
+template <class Graph>
+std::pair<bool,typename Graph::idx_list_t> Johnson<Graph>::getPath (const idx_t src, const idx_t dest) const {
+  checkQuery("getPath", src, dest);
+  const idx_t n = graph_->numNodes();
+  if (dist_[src*n+dest].isInfinite())
+    return {false,{}};
+
+  // backtracking
+  idx_list_t out;
+  for (idx_t u = dest; u != src; u = pred_[src*n+u])
+    out.push_back(u);
+  out.push_back(src);
+  std::reverse(out.begin(),out.end());
+  return {true,out};
+}
+
+template <class Graph>
+ShortestPathTree<Graph> Johnson<Graph>::getShortestPathTree (const idx_t src) const
+{
+  checkQuery("getShortestPathTree", src, src);
+  const idx_t n = graph_->numNodes();
+  return ShortestPathTree<Graph>(graph_, src, std::vector<idx_t>(pred_.begin() + src*n, pred_.begin() + (src+1)*n));
+}
+
+template <class Graph>
+Graph Johnson<Graph>::getSPT (const idx_t src) const
+{
+  checkQuery("getSPT", src, src);
+  return getShortestPathTree(src).toGraph();
+}
+
+template <class Graph>
+double Johnson<Graph>::closenessCentrality (const idx_t id) const
+{
+  checkQuery("closenessCentrality", id, id);
+
+  double result = 0;
+  for (idx_t i = 0; i < graph_->numNodes(); ++i)
+  {
+    if (id == i) continue;
+    Distance<val_t> distance = pathLength(i,id);
+    if (distance.isInfinite())
+      return 0;
+    else
+      result += distance.scalarDistance();
+  }
+  return static_cast<double>((graph_->numNodes()-1)/result);
+}
+
+template <class Graph>
+double Johnson<Graph>::harmonicCentrality (const idx_t id) const
+{
+  checkQuery("harmonicCentrality", id, id);
+
+  double result = 0;
+  for (idx_t i = 0; i < graph_->numNodes(); ++i)
+  {
+    if (id == i) continue;
+    Distance<val_t> distance = pathLength(i,id);
+    if (distance.isInfinite())
+      continue;
+    else
+      result += 1./distance.scalarDistance();
+  }
+  return static_cast<double>(result/(graph_->numNodes()-1));
+}
+
+} // namespace algorithm
+} // namespace gl
+
+#endif // GL_JOHNSON_HPP
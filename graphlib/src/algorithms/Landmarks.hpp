@@ -0,0 +1,330 @@
+#ifndef GL_LANDMARKS_HPP
+#define GL_LANDMARKS_HPP
+
+#include "../gl_base.hpp"
+#include "../gl_parallel.hpp"
+#include "AStar.hpp"
+#include "Dijkstra.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace gl::algorithm {
+
+///////////////////////////////////////////////////////////
+//    Class declaration
+///////////////////////////////////////////////////////////
+
+/**
+ * @brief Strategy that places the landmarks of a LandmarkHeuristic.
+ */
+enum class LandmarkSelection {
+  Farthest, ///< Each landmark is the node farthest away from the landmarks chosen before.
+  Avoid     ///< Each landmark is a leaf of a shortest path tree whose paths are badly covered by the landmarks chosen before.
+};
+
+/**
+ * For every landmark L, the distances from L (and, in directed graphs, to L) are stored for all nodes, k landmarks take k*n
+ * (directed: 2*k*n) values. By the triangle inequality, d(v,t) >= d(L,t) - d(L,v) and d(v,t) >= d(v,L) - d(t,L);
+ * the heuristic returns the largest of these bounds, which is consistent.
+ * The landmarks are chosen one after another, each distance table is then computed by its own task.
+ * The tables are shared between copies of the heuristic and have to be recomputed if edge weights of the graph decrease.
+ * @class LandmarkHeuristic
+ * @brief A* heuristic from precomputed landmark distances (ALT).
+ */
+template <class Graph>
+class LandmarkHeuristic {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+  /**
+   * @brief Default constructor. Without landmarks the estimate is always 0.
+   */
+  LandmarkHeuristic() = default;
+  /**
+   * @brief Selects landmarks and computes their distance tables.
+   * @param[in] graph Graph with positive edge weights
+   * @param[in] numLandmarks Number of landmarks k, the tables hold k*n distances per direction.
+   * @param[in] selection Landmark selection strategy
+   * @param[in] numThreads Number of threads computing the tables, 0 uses all hardware threads.
+   */
+  LandmarkHeuristic(const Graph& graph, const idx_t numLandmarks, const LandmarkSelection selection = LandmarkSelection::Farthest, const unsigned numThreads = 0);
+  /**
+   * @brief Computes the distance tables of the given landmarks.
+   * @param[in] graph Graph with positive edge weights
+   * @param[in] landmarks Landmark node IDs
+   * @param[in] numThreads Number of threads computing the tables, 0 uses all hardware threads.
+   */
+  LandmarkHeuristic(const Graph& graph, const idx_list_t& landmarks, const unsigned numThreads = 0);
+
+  /**
+   * @brief Lower bound of the distance from node to target.
+   * @param[in] graph Graph the tables were computed for
+   * @param[in] node Node ID
+   * @param[in] target Target node ID
+   * @return Largest triangle inequality bound over all landmarks, at least 0.
+   */
+  double operator()(const Graph& graph, const idx_t node, const idx_t target) const;
+  /**
+   * @brief Landmarks in the order they were chosen.
+   * @return List of landmark node IDs.
+   */
+  const idx_list_t& landmarks() const { return landmarks_; }
+  /**
+   * @brief Number of landmarks.
+   * @return Number of landmarks.
+   */
+  idx_t numLandmarks() const { return landmarks_.size(); }
+  /**
+   * @brief Memory used by the distance tables.
+   * @return Size of the tables in bytes.
+   */
+  std::size_t memoryUsage() const;
+
+private:
+  /**
+   * @brief Distance tables, row i belongs to landmark i.
+   */
+  struct Tables {
+    std::vector<val_t> from; ///< @brief from[i*n+v] = d(landmark i, v), GL_INF if unreachable
+    std::vector<val_t> to;   ///< @brief to[i*n+v] = d(v, landmark i), empty for undirected graphs
+  };
+
+  /**
+   * @brief Chooses the landmarks, filling the rows of tables.from on the way.
+   */
+  void select(const Graph& graph, const idx_t numLandmarks, const LandmarkSelection selection, Tables& tables);
+  /**
+   * @brief Node farthest away from all landmarks chosen so far (unreachable nodes first).
+   */
+  idx_t farthest(const std::vector<double>& closest) const;
+  /**
+   * @brief Leaf of a shortest path tree from a random root with the largest badly covered subtree.
+   */
+  idx_t avoid(Dijkstra<Graph>& dijkstra, const Tables& tables, std::mt19937& gen, const std::vector<double>& closest) const;
+  /**
+   * @brief Computes the rows (landmark index, reverse) of the tables, one task per row.
+   */
+  void computeRows(const Graph& graph, const std::vector<std::pair<idx_t,bool>>& rows, const unsigned numThreads, Tables& tables) const;
+  /**
+   * @brief Copies a distance vector into a row.
+   */
+  void fillRow(std::vector<val_t>& table, const idx_t row, const std::vector<Distance<val_t>>& distances) const;
+
+  idx_list_t landmarks_;                 ///< @brief Landmark node IDs
+  idx_t numNodes_ = 0;                   ///< @brief Number of nodes the tables were computed for
+  std::shared_ptr<const Tables> tables_; ///< @brief Distance tables, shared between copies
+};
+
+/**
+ * @brief A* with landmark lower bounds (ALT).
+ */
+template <class Graph>
+using ALT = AStar<Graph, LandmarkHeuristic<Graph>>;
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+LandmarkHeuristic<Graph>::LandmarkHeuristic(const Graph& graph, const idx_t numLandmarks, const LandmarkSelection selection, const unsigned numThreads)
+                                            : numNodes_(graph.numNodes())
+{
+  GL_ASSERT(numLandmarks <= numNodes_, "LandmarkHeuristic::select | More landmarks requested than the graph has nodes.");
+  auto tables = std::make_shared<Tables>();
+  select(graph, numLandmarks, selection, *tables);
+  std::vector<std::pair<idx_t,bool>> rows;
+  if (graph.isDirected()) {
+    tables->to.assign(numLandmarks * numNodes_, GL_INF(val_t));
+    for (idx_t i = 0; i < numLandmarks; ++i)
+      rows.emplace_back(i, true);
+  }
+  computeRows(graph, rows, resolveThreads(numThreads), *tables);
+  tables_ = std::move(tables);
+}
+
+template <class Graph>
+LandmarkHeuristic<Graph>::LandmarkHeuristic(const Graph& graph, const idx_list_t& landmarks, const unsigned numThreads)
+                                            : landmarks_(landmarks), numNodes_(graph.numNodes())
+{
+  for (auto landmark : landmarks)
+    graph.checkRange(landmark);
+  auto tables = std::make_shared<Tables>();
+  tables->from.assign(landmarks.size() * numNodes_, GL_INF(val_t));
+  std::vector<std::pair<idx_t,bool>> rows;
+  for (idx_t i = 0; i < landmarks.size(); ++i)
+    rows.emplace_back(i, false);
+  if (graph.isDirected()) {
+    tables->to.assign(landmarks.size() * numNodes_, GL_INF(val_t));
+    for (idx_t i = 0; i < landmarks.size(); ++i)
+      rows.emplace_back(i, true);
+  }
+  computeRows(graph, rows, resolveThreads(numThreads), *tables);
+  tables_ = std::move(tables);
+}
+
+template <class Graph>
+double LandmarkHeuristic<Graph>::operator()(const Graph&, const idx_t node, const idx_t target) const
+{
+  if (!tables_) return 0.;
+  const auto& from = tables_->from;
+  const auto& to = tables_->to.empty() ? tables_->from : tables_->to;
+  double h = 0.;
+  for (idx_t row = 0; row < from.size(); row += numNodes_) {
+    val_t lt = from[row + target], lv = from[row + node];
+    if (lt != GL_INF(val_t) && lv != GL_INF(val_t))
+      h = std::max(h, double(lt) - double(lv));
+    val_t vl = to[row + node], tl = to[row + target];
+    if (vl != GL_INF(val_t) && tl != GL_INF(val_t))
+      h = std::max(h, double(vl) - double(tl));
+  }
+  return h;
+}
+
+template <class Graph>
+std::size_t LandmarkHeuristic<Graph>::memoryUsage() const
+{
+  if (!tables_) return 0;
+  return (tables_->from.size() + tables_->to.size()) * sizeof(val_t);
+}
+
+template <class Graph>
+void LandmarkHeuristic<Graph>::fillRow(std::vector<val_t>& table, const idx_t row, const std::vector<Distance<val_t>>& distances) const
+{
+  for (idx_t v = 0; v < numNodes_; ++v)
+    table[row * numNodes_ + v] = distances[v].scalarDistance(); // GL_INF if unreachable
+}
+
+template <class Graph>
+typename Graph::idx_t LandmarkHeuristic<Graph>::farthest(const std::vector<double>& closest) const
+{
+  idx_t best = numNodes_;
+  for (idx_t v = 0; v < numNodes_; ++v) {
+    if (closest[v] <= 0.) continue; // landmarks
+    if (best == numNodes_ || closest[v] > closest[best]) best = v;
+  }
+  return best == numNodes_ ? 0 : best;
+}
+
+template <class Graph>
+typename Graph::idx_t LandmarkHeuristic<Graph>::avoid(Dijkstra<Graph>& dijkstra, const Tables& tables, std::mt19937& gen,
+                                                      const std::vector<double>& closest) const
+{
+  std::uniform_int_distribution<idx_t> pick(0, numNodes_ - 1);
+  const idx_t root = pick(gen);
+  std::vector<Distance<val_t>> distances;
+  idx_list_t predecessors;
+  dijkstra.queryDistances(root, distances, predecessors);
+
+  // weight: how much the current landmarks underestimate the distance from the root
+  idx_list_t order;
+  std::vector<double> size(numNodes_, 0.);
+  for (idx_t v = 0; v < numNodes_; ++v) {
+    if (distances[v].isInfinite()) continue;
+    order.push_back(v);
+    double d = distances[v].scalarDistance(), bound = 0.;
+    for (idx_t row = 0; row < landmarks_.size() * numNodes_; row += numNodes_) {
+      val_t lr = tables.from[row + root], lv = tables.from[row + v];
+      if (lr == GL_INF(val_t) || lv == GL_INF(val_t)) continue;
+      bound = std::max(bound, double(lv) - double(lr));
+      if (tables.to.empty()) bound = std::max(bound, double(lr) - double(lv));
+    }
+    size[v] = std::max(0., d - bound);
+  }
+
+  // subtree sizes, children before parents; subtrees containing a landmark do not count
+  std::sort(order.begin(), order.end(), [&distances](idx_t lhs, idx_t rhs) {
+    return std::make_pair(distances[lhs].scalarDistance(), lhs) > std::make_pair(distances[rhs].scalarDistance(), rhs);
+  });
+  std::vector<char> hasLandmark(numNodes_, 0);
+  for (auto landmark : landmarks_)
+    hasLandmark[landmark] = 1;
+  for (auto v : order) {
+    if (hasLandmark[v]) size[v] = 0.;
+    if (v == root) continue;
+    size[predecessors[v]] += size[v];
+    hasLandmark[predecessors[v]] |= hasLandmark[v];
+  }
+
+  idx_t best = numNodes_;
+  for (auto v : order)
+    if (size[v] > 0. && (best == numNodes_ || size[v] > size[best] || (size[v] == size[best] && v < best)))
+      best = v;
+  if (best == numNodes_)
+    return farthest(closest);
+
+  // descend to a leaf along the largest subtrees
+  std::vector<idx_list_t> children(numNodes_);
+  for (auto v : order)
+    if (v != root) children[predecessors[v]].push_back(v);
+  while (!children[best].empty()) {
+    idx_t next = children[best].front();
+    for (auto child : children[best])
+      if (size[child] > size[next] || (size[child] == size[next] && child < next))
+        next = child;
+    best = next;
+  }
+  return best;
+}
+
+template <class Graph>
+void LandmarkHeuristic<Graph>::select(const Graph& graph, const idx_t numLandmarks, const LandmarkSelection selection, Tables& tables)
+{
+  tables.from.assign(numLandmarks * numNodes_, GL_INF(val_t));
+  if (numLandmarks == 0) return;
+  Dijkstra<Graph> dijkstra(graph);
+  std::vector<Distance<val_t>> distances;
+  std::mt19937 gen(numNodes_);
+
+  // the first landmark is the node farthest away from node 0
+  dijkstra.queryDistances(0, distances);
+  idx_t next = 0;
+  for (idx_t v = 1; v < numNodes_; ++v)
+    if (!distances[v].isInfinite() && distances[next] < distances[v])
+      next = v;
+
+  // distance of every node to the closest landmark, infinite if no landmark reaches it, 0 for landmarks
+  std::vector<double> closest(numNodes_, GL_INF(double));
+  for (idx_t i = 0; i < numLandmarks; ++i) {
+    if (i > 0)
+      next = selection == LandmarkSelection::Avoid ? avoid(dijkstra, tables, gen, closest) : farthest(closest);
+    landmarks_.push_back(next);
+    dijkstra.queryDistances(next, distances);
+    fillRow(tables.from, i, distances);
+    for (idx_t v = 0; v < numNodes_; ++v)
+      if (!distances[v].isInfinite()) closest[v] = std::min(closest[v], double(distances[v].scalarDistance()));
+    closest[next] = 0.;
+  }
+}
+
+template <class Graph>
+void LandmarkHeuristic<Graph>::computeRows(const Graph& graph, const std::vector<std::pair<idx_t,bool>>& rows, const unsigned numThreads, Tables& tables) const
+{
+  bool reverse = std::any_of(rows.begin(), rows.end(), [](const auto& row) { return row.second; });
+  Graph reversed(reverse ? numNodes_ : 0);
+  if (reverse)
+    for (auto it = graph.edge_cbegin(); it != graph.edge_cend(); ++it)
+      reversed.setEdge(it->dest(), it->source(), it->weight());
+
+  // one Dijkstra per thread and direction, each task computes one row
+  std::vector<Dijkstra<Graph>> forward(numThreads), backward(numThreads);
+  std::vector<char> initialized(2 * numThreads, 0);
+  std::vector<std::vector<Distance<val_t>>> distances(numThreads);
+  parallelFor(rows.size(), numThreads, [&](std::size_t i, unsigned thread) {
+    auto& dijkstra = rows[i].second ? backward[thread] : forward[thread];
+    if (!initialized[2 * thread + rows[i].second]) {
+      dijkstra.initialize(rows[i].second ? reversed : graph);
+      initialized[2 * thread + rows[i].second] = 1;
+    }
+    dijkstra.queryDistances(landmarks_[rows[i].first], distances[thread]);
+    fillRow(rows[i].second ? tables.to : tables.from, rows[i].first, distances[thread]);
+  }, 1);
+}
+
+} // namespace gl::algorithm
+
+#endif // GL_LANDMARKS_HPP
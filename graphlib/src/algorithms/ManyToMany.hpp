@@ -0,0 +1,131 @@
+#ifndef GL_MANY_TO_MANY_HPP
+#define GL_MANY_TO_MANY_HPP
+
+#include "../gl_base.hpp"
+#include "../gl_parallel.hpp"
+#include "../structures/AdjacencyArray.hpp"
+#include "../structures/DistanceTable.hpp"
+#include "../structures/SearchWorkspace.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace gl::algorithm {
+
+///////////////////////////////////////////////////////////
+//    Class declaration
+///////////////////////////////////////////////////////////
+
+/**
+ * Duplicate sources share one search, and every search stops as soon as all targets are settled.
+ * The searches of different sources run in parallel. They use a flat snapshot of the graph, so later
+ * modifications of the graph are not observed.
+ * On road networks, ContractionHierarchies::distanceTable() answers the same query with bucket based target pruning.
+ * @class ManyToMany
+ * @brief Computes dense distance tables between sets of sources and targets.
+ */
+template <class Graph>
+class ManyToMany {
+  using idx_t = typename Graph::idx_t;
+  using val_t = typename Graph::val_t;
+  using idx_list_t = typename Graph::idx_list_t;
+
+public:
+  /**
+   * @brief Takes a snapshot of the graph.
+   * @param[in] graph Graph with positive edge weights
+   * @param[in] numThreads Number of threads used by distanceTable(), 0 for all hardware threads
+   */
+  explicit ManyToMany(const Graph& graph, unsigned numThreads = 0);
+
+  ManyToMany() = default;                                   ///< Default constructor
+  ManyToMany(const ManyToMany &) = default;                 ///< Copy constructor
+  ManyToMany(ManyToMany &&) noexcept = default;             ///< Move constructor
+  ManyToMany &operator=(const ManyToMany &) = default;      ///< Copy assignment
+  ManyToMany &operator=(ManyToMany &&) noexcept = default;  ///< Move assignment
+  ~ManyToMany() = default;                                  ///< Default destructor
+
+  /**
+   * @brief Computes the shortest path lengths from every source to every target.
+   * @param[in] sources Row nodes, may contain duplicates
+   * @param[in] targets Column nodes, may contain duplicates
+   * @return Table of distances, infinite for unreachable targets.
+   */
+  DistanceTable<val_t> distanceTable(const idx_list_t& sources, const idx_list_t& targets) const;
+  /**
+   * @brief Number of nodes of the snapshot.
+   * @return Number of nodes.
+   */
+  idx_t numNodes() const { return edges_.numNodes(); }
+
+private:
+  AdjacencyArray<val_t> edges_;   ///< @brief Outgoing edges of the graph
+  unsigned numThreads_ = 1;       ///< @brief Number of threads
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+ManyToMany<Graph>::ManyToMany(const Graph& graph, unsigned numThreads) : edges_(graph), numThreads_(resolveThreads(numThreads))
+{
+  GL_ASSERT(graph.numNonPositiveEdges() == 0, "ManyToMany::ManyToMany | Found non-positive edge weights in the graph.");
+}
+
+template <class Graph>
+DistanceTable<typename Graph::val_t> ManyToMany<Graph>::distanceTable(const idx_list_t& sources, const idx_list_t& targets) const
+{
+  const idx_t n = numNodes();
+  for (auto node : sources)
+    GL_ASSERT(node < n, "ManyToMany::distanceTable | Node index out of range.");
+  for (auto node : targets)
+    GL_ASSERT(node < n, "ManyToMany::distanceTable | Node index out of range.");
+
+  // group the queries: one search per distinct source, one column slot per distinct target
+  idx_list_t uniqueSources(sources), uniqueTargets(targets);
+  std::sort(uniqueSources.begin(), uniqueSources.end());
+  uniqueSources.erase(std::unique(uniqueSources.begin(), uniqueSources.end()), uniqueSources.end());
+  std::sort(uniqueTargets.begin(), uniqueTargets.end());
+  uniqueTargets.erase(std::unique(uniqueTargets.begin(), uniqueTargets.end()), uniqueTargets.end());
+  std::vector<idx_t> slot(n, GL_INF(idx_t));
+  for (idx_t j = 0; j < uniqueTargets.size(); ++j)
+    slot[uniqueTargets[j]] = j;
+
+  const idx_t numUnique = uniqueTargets.size();
+  std::vector<Distance<val_t>> rows(uniqueSources.size() * numUnique);
+  std::vector<SearchWorkspace<val_t>> workspaces(std::min<std::size_t>(numThreads_, uniqueSources.size()));
+  parallelFor(uniqueSources.size(), numThreads_, [&](const std::size_t i, const unsigned thread) {
+    auto& workspace = workspaces[thread];
+    if (workspace.size() != n) workspace.resize(n);
+    else workspace.reset();
+    Distance<val_t>* row = rows.data() + i * numUnique;
+
+    idx_t remaining = numUnique;
+    workspace.relax(uniqueSources[i], val_t(0), uniqueSources[i]);
+    while (remaining > 0 && !workspace.empty()) {
+      auto top = workspace.pop();
+      idx_t u = top.second;
+      if (workspace.isSettled(u) || top.first > workspace.distance(u)) continue;
+      workspace.settle(u);
+      if (slot[u] != GL_INF(idx_t)) {
+        row[slot[u]] = Distance<val_t>(top.first);
+        --remaining;
+      }
+      for (idx_t e = edges_.begin(u); e < edges_.end(u); ++e)
+        workspace.relax(edges_.target(e), top.first + edges_.weight(e), u);
+    }
+  }, 1);
+
+  DistanceTable<val_t> table(sources, targets);
+  for (idx_t i = 0; i < sources.size(); ++i) {
+    idx_t row = std::lower_bound(uniqueSources.begin(), uniqueSources.end(), sources[i]) - uniqueSources.begin();
+    for (idx_t j = 0; j < targets.size(); ++j)
+      table(i, j) = rows[row * numUnique + slot[targets[j]]];
+  }
+  return table;
+}
+
+} // namespace gl::algorithm
+
+#endif // GL_MANY_TO_MANY_HPP
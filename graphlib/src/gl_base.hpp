@@ -7,6 +7,20 @@
 #define GL_INF(ValueType) \
 std::numeric_limits<ValueType>::max()
 
+/**
+ * @brief Number of edge modifications a Graph remembers (see Graph::getEdgeChangesSince).
+ */
+#ifndef GL_CHANGE_LOG_CAPACITY
+#define GL_CHANGE_LOG_CAPACITY 256
+#endif
+
+/**
+ * @brief Largest edge weight for which Dijkstra uses a bucket queue on integer graphs; larger weights use a radix heap.
+ */
+#ifndef GL_DIAL_MAX_WEIGHT
+#define GL_DIAL_MAX_WEIGHT 1024
+#endif
+
 namespace gl
 {
   class Matrix;
@@ -0,0 +1,54 @@
+#ifndef GL_PARALLEL_HPP
+#define GL_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace gl
+{
+  /**
+   * @brief Resolves a requested number of threads.
+   * @param[in] numThreads Requested number of threads, 0 for all hardware threads.
+   * @return Number of threads to use, at least 1.
+   */
+  inline unsigned resolveThreads(const unsigned numThreads)
+  {
+    return numThreads != 0 ? numThreads : std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  /**
+   * The indices are handed out in chunks to numThreads threads, fn must be safe to call concurrently for different indices.
+   * The calling thread takes part as thread 0; with one thread (or a single chunk) everything runs on the calling thread.
+   * @brief Calls fn(i, thread) for all i in [0, count).
+   * @param[in] count Number of indices
+   * @param[in] numThreads Number of threads, thread IDs passed to fn are in [0, numThreads)
+   * @param[in] fn Callable (std::size_t index, unsigned thread)
+   * @param[in] chunk Number of consecutive indices a thread takes at once
+   */
+  template <class Function>
+  void parallelFor(const std::size_t count, const unsigned numThreads, const Function& fn, const std::size_t chunk = 16)
+  {
+    unsigned threads = unsigned(std::min<std::size_t>(numThreads, (count + chunk - 1) / chunk));
+    if (threads <= 1) {
+      for (std::size_t i = 0; i < count; ++i)
+        fn(i, 0u);
+      return;
+    }
+    std::atomic<std::size_t> next(0);
+    auto work = [&](const unsigned thread) {
+      for (std::size_t begin = next.fetch_add(chunk); begin < count; begin = next.fetch_add(chunk))
+        for (std::size_t i = begin; i < std::min(begin + chunk, count); ++i)
+          fn(i, thread);
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t)
+      pool.emplace_back(work, t);
+    work(0u);
+    for (auto& thread : pool)
+      thread.join();
+  }
+} /* namespace gl */
+
+#endif // GL_PARALLEL_HPP
@@ -3,26 +3,29 @@
 
 #include "../gl_base.hpp"
 #include "../structures/Color.hpp"
+#include "../structures/SharedGraph.hpp"
 
 #include <functional>
+#include <memory>
+#include <type_traits>
 
 namespace gl::interface 
 {
 
 /**
- * @brief Provides a Selector Object to color the edges in a given Graph.
+ * @brief Provides a Selector Object to color the edges in a given shared Graph.
  * @tparam GRAPH Some Graph type
- * @param[in] graph Graph that contains edges that are to be colored
+ * @param[in] graph Handle to the graph that contains edges that are to be colored. The selector keeps the handle alive.
  * @param[in] trueColor (optional) New color for the graph edges.
  * @param[in] falseColor (optional) New color for all non-graph edges.
  * @return Selector Object: std::pair<bool,gl::Color>
  */
 template <class GRAPH>
-std::function<std::pair<bool,gl::Color>(const gl::index_type src, const gl::index_type dest)> getEdgeSelectorFromGraph (const GRAPH& graph,
+std::function<std::pair<bool,gl::Color>(const gl::index_type src, const gl::index_type dest)> getEdgeSelectorFromGraph (const gl::SharedGraph<GRAPH>& graph,
 const gl::Color& trueColor = gl::Color("red"), const gl::Color& falseColor = gl::Color("black"))
 {
   return [graph, trueColor, falseColor](const gl::index_type src, const gl::index_type dest) -> std::pair<bool,gl::Color> {
-      if (graph.hasEdge(src,dest)) 
+      if (graph->hasEdge(src,dest)) 
       {
         return {true,trueColor};
       }
@@ -31,6 +34,37 @@ const gl::Color& trueColor = gl::Color("red"), const gl::Color& falseColor = gl:
     };
 }
 
+/**
+ * @brief Provides a Selector Object to color the edges in a given Graph.
+ * @warning The graph is referenced, not copied. It has to outlive the selector.
+ * @tparam GRAPH Some Graph type
+ * @param[in] graph Graph that contains edges that are to be colored
+ * @param[in] trueColor (optional) New color for the graph edges.
+ * @param[in] falseColor (optional) New color for all non-graph edges.
+ * @return Selector Object: std::pair<bool,gl::Color>
+ */
+template <class GRAPH>
+std::function<std::pair<bool,gl::Color>(const gl::index_type src, const gl::index_type dest)> getEdgeSelectorFromGraph (const GRAPH& graph,
+const gl::Color& trueColor = gl::Color("red"), const gl::Color& falseColor = gl::Color("black"))
+{
+  return getEdgeSelectorFromGraph(gl::SharedGraph<GRAPH>::view(graph),trueColor,falseColor);
+}
+
+/**
+ * @brief Provides a Selector Object to color the edges in a given temporary Graph.
+ * @tparam GRAPH Some Graph type
+ * @param[in] graph Graph that contains edges that are to be colored. It is moved into the selector.
+ * @param[in] trueColor (optional) New color for the graph edges.
+ * @param[in] falseColor (optional) New color for all non-graph edges.
+ * @return Selector Object: std::pair<bool,gl::Color>
+ */
+template <class GRAPH, std::enable_if_t<!std::is_reference_v<GRAPH>, int> = 0>
+std::function<std::pair<bool,gl::Color>(const gl::index_type src, const gl::index_type dest)> getEdgeSelectorFromGraph (GRAPH&& graph,
+const gl::Color& trueColor = gl::Color("red"), const gl::Color& falseColor = gl::Color("black"))
+{
+  return getEdgeSelectorFromGraph(gl::SharedGraph<GRAPH>(std::move(graph)),trueColor,falseColor);
+}
+
 /**
  * @brief Provides a Selector Object to color the edges in a given Path.
  * @tparam PATH std::pair<bool,typename Graph::idx_list_t>. A Path type whose first element contains a boolean value that states path existence, and the second pair element contains a vector of node IDs in the shortest path. 
@@ -76,8 +110,9 @@ std::function<std::pair<bool,gl::Color>(const gl::index_type src, const gl::inde
 }
 
 /**
+ * The tree is requested from spa on the first call and reused afterwards, every call is then an O(1) parent lookup.
  * @brief Provides a Selector Object to color the edges in a Shortest Path Tree.
- * @tparam SHORTEST_PATH_ALGORITHM Shortest Path Algorithm that supports a call to getPath(src,dest) that returns an std::pair<bool,typename Graph::idx_list_t> whose first element contains a boolean value that states path existence, and the second pair element contains a vector of node IDs in the shortest path. 
+ * @tparam SHORTEST_PATH_ALGORITHM Shortest Path Algorithm that supports a call to getShortestPathTree(src) that returns a gl::ShortestPathTree.
  * @param[in] spa Shortest Path Algorithm (e.g. FloydWarshall, Dijkstra)
  * @param[in] treeSource Source of the shortest path tree
  * @param[in] trueColor (optional) New color for the SPT edges.
@@ -88,10 +123,15 @@ template <class SHORTEST_PATH_ALGORITHM>
 std::function<std::pair<bool,gl::Color>(const gl::index_type src, const gl::index_type dest)> getEdgeSelectorFromShortestPathTree (SHORTEST_PATH_ALGORITHM& spa, const gl::index_type treeSource,
 const gl::Color& trueColor = gl::Color("red"), const gl::Color& falseColor = gl::Color("black"))
 {
-  return [&spa, treeSource, trueColor, falseColor](const gl::index_type src, const gl::index_type dest) -> std::pair<bool,gl::Color> {
-        auto spt = spa.getSPT(treeSource);
-        auto selEdge = getEdgeSelectorFromGraph(spt,trueColor,falseColor);
-        return selEdge(src,dest);
+  using tree_t = decltype(spa.getShortestPathTree(treeSource));
+  auto tree = std::make_shared<std::unique_ptr<tree_t>>();
+  return [&spa, treeSource, trueColor, falseColor, tree](const gl::index_type src, const gl::index_type dest) -> std::pair<bool,gl::Color> {
+        if (!*tree)
+          *tree = std::make_unique<tree_t>(spa.getShortestPathTree(treeSource));
+        if ((*tree)->hasEdge(src,dest))
+          return {true,trueColor};
+        else
+          return {false,falseColor};
     };
 }
 
@@ -0,0 +1,133 @@
+#ifndef GL_ADJACENCY_ARRAY_HPP
+#define GL_ADJACENCY_ARRAY_HPP
+
+#include "../gl_base.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+/**
+ * The outgoing edges of node u are stored contiguously at the positions begin(u) to end(u)-1,
+ * which makes scanning neighbours cache friendly and allocation free (compressed sparse row format).
+ * It is a read-only snapshot: modifications of the Graph are not reflected.
+ * @class AdjacencyArray
+ * @brief Static, flat adjacency structure of a Graph or of its reverse.
+ * @tparam SCALAR Number type used to store edge weights.
+ */
+template <class SCALAR>
+class AdjacencyArray
+{
+public:
+  using val_t = SCALAR;         ///< Value type
+  using idx_t = gl::index_type; ///< Index type
+
+  /**
+   * @brief Default constructor. Creates an adjacency array without nodes.
+   */
+  AdjacencyArray() = default;
+  /**
+   * Self-loops are skipped. For undirected graphs, the reverse graph is the graph itself.
+   * @brief Takes a snapshot of the edges of a graph.
+   * @param[in] graph Graph whose edges are stored.
+   * @param[in] reverse If true, every edge u->v is stored as v->u.
+   */
+  template <class GRAPH>
+  explicit AdjacencyArray(const GRAPH &graph, const bool reverse = false);
+
+  AdjacencyArray(const AdjacencyArray &) = default;                ///< @brief Copy constructor
+  AdjacencyArray(AdjacencyArray &&) noexcept = default;            ///< @brief Move constructor
+  AdjacencyArray &operator=(const AdjacencyArray &) = default;     ///< @brief Copy assignment
+  AdjacencyArray &operator=(AdjacencyArray &&) noexcept = default; ///< @brief Move assignment
+  ~AdjacencyArray() = default;                                     ///< @brief Destructor
+
+  /**
+   * @brief Number of nodes.
+   * @return Number of nodes.
+   */
+  idx_t numNodes() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+  /**
+   * @brief Number of stored (directed) edges.
+   * @return Number of edges.
+   */
+  idx_t numEdges() const { return targets_.size(); }
+  /**
+   * @brief Position of the first outgoing edge of a node.
+   * @param[in] node Node ID
+   * @return Edge position.
+   */
+  idx_t begin(const idx_t node) const { return offsets_[node]; }
+  /**
+   * @brief Position past the last outgoing edge of a node.
+   * @param[in] node Node ID
+   * @return Edge position.
+   */
+  idx_t end(const idx_t node) const { return offsets_[node + 1]; }
+  /**
+   * @brief Number of outgoing edges of a node.
+   * @param[in] node Node ID
+   * @return Out-degree.
+   */
+  idx_t degree(const idx_t node) const { return end(node) - begin(node); }
+  /**
+   * @brief Endpoint of the edge at the given position.
+   * @param[in] edge Edge position
+   * @return Node ID
+   */
+  idx_t target(const idx_t edge) const { return targets_[edge]; }
+  /**
+   * @brief Weight of the edge at the given position.
+   * @param[in] edge Edge position
+   * @return Edge weight
+   */
+  val_t weight(const idx_t edge) const { return weights_[edge]; }
+
+private:
+  std::vector<idx_t> offsets_; ///< @brief Start of the edges of every node, plus one end marker
+  std::vector<idx_t> targets_; ///< @brief Edge endpoints
+  std::vector<val_t> weights_; ///< @brief Edge weights
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class SCALAR>
+template <class GRAPH>
+AdjacencyArray<SCALAR>::AdjacencyArray(const GRAPH &graph, const bool reverse)
+{
+  idx_t n = graph.numNodes();
+  typename GRAPH::dest_vec_t neighbours;
+  std::vector<std::pair<idx_t, std::pair<idx_t, val_t>>> edges;
+  offsets_.assign(n + 1, 0);
+  for (idx_t u = 0; u < n; ++u)
+  {
+    graph.getNeighbourWeights(u, neighbours);
+    for (const auto &x : neighbours)
+    {
+      if (x.first == u)
+        continue;
+      idx_t from = reverse ? x.first : u;
+      idx_t to = reverse ? u : x.first;
+      edges.push_back({from, {to, val_t(x.second)}});
+      ++offsets_[from + 1];
+    }
+  }
+  for (idx_t u = 0; u < n; ++u)
+    offsets_[u + 1] += offsets_[u];
+  // counting sort by origin
+  targets_.resize(edges.size());
+  weights_.resize(edges.size());
+  std::vector<idx_t> next(offsets_.begin(), offsets_.end() - 1);
+  for (const auto &edge : edges)
+  {
+    idx_t pos = next[edge.first]++;
+    targets_[pos] = edge.second.first;
+    weights_[pos] = edge.second.second;
+  }
+}
+
+} // namespace gl
+
+#endif // GL_ADJACENCY_ARRAY_HPP
@@ -0,0 +1,82 @@
+#ifndef GL_BUCKET_QUEUE_HPP
+#define GL_BUCKET_QUEUE_HPP
+
+#include "../gl_base.hpp"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+/**
+ * Dial's bucket queue: with edge weights of at most C, all queued keys lie in [min, min+C],
+ * so C+1 cyclic buckets indexed by key modulo C+1 suffice. Pushing is O(1), popping scans forward to the next
+ * non-empty bucket, which costs O(C) in total per unit of key increase.
+ * The queue is monotone: keys must not be smaller than the last popped key. Outdated entries are not removed (lazy deletion).
+ * @class BucketQueue
+ * @brief Monotone priority queue for small non-negative integer keys.
+ * @tparam KEY Integral key type.
+ */
+template <class KEY>
+class BucketQueue
+{
+  static_assert(std::is_integral_v<KEY>, "BucketQueue | The key type has to be integral.");
+
+public:
+  using key_t = KEY;                        ///< Key type
+  using idx_t = gl::index_type;             ///< Index type
+  using entry_t = std::pair<key_t, idx_t>;  ///< (key, node) pair
+
+  /**
+   * @brief Creates a queue for keys that exceed the smallest queued key by at most maxWeight.
+   * @param[in] maxWeight Largest edge weight C
+   */
+  explicit BucketQueue(const key_t maxWeight = 0) : buckets_(std::size_t(maxWeight) + 1) {}
+
+  /**
+   * @brief Checks whether the queue is empty.
+   * @return true if no entry is queued.
+   */
+  bool empty() const { return size_ == 0; }
+  /**
+   * @brief Number of queued entries.
+   * @return Queue size.
+   */
+  idx_t size() const { return size_; }
+  /**
+   * @warning key has to lie in [last popped key, last popped key + maxWeight].
+   * @brief Queues a node. O(1).
+   * @param[in] key Key of the node
+   * @param[in] node Node ID
+   */
+  void push(const key_t key, const idx_t node)
+  {
+    buckets_[std::size_t(key) % buckets_.size()].push_back(node);
+    ++size_;
+  }
+  /**
+   * @warning The queue must not be empty.
+   * @brief Removes and returns an entry with the smallest key.
+   * @return (key, node) pair
+   */
+  entry_t pop()
+  {
+    while (buckets_[std::size_t(current_) % buckets_.size()].empty())
+      ++current_;
+    auto& bucket = buckets_[std::size_t(current_) % buckets_.size()];
+    idx_t node = bucket.back();
+    bucket.pop_back();
+    --size_;
+    return {current_, node};
+  }
+
+private:
+  std::vector<std::vector<idx_t>> buckets_; ///< @brief Cyclic buckets of node IDs
+  key_t current_ = 0;                       ///< @brief Key of the bucket the last entry was popped from
+  idx_t size_ = 0;                          ///< @brief Number of queued entries
+};
+
+} // namespace gl
+
+#endif // GL_BUCKET_QUEUE_HPP
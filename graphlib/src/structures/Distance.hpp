@@ -1,77 +1,111 @@
 #ifndef GL_DISTANCE_HPP
 #define GL_DISTANCE_HPP
 
+#include "../gl_base.hpp"
+#include "PathAlgebra.hpp"
+
 #include <string>
+#include <type_traits>
 
-namespace gl 
+namespace gl
 {
 /**
+ * Infinity is encoded as the sentinel value GL_INF(SCALAR), so a Distance has the size of SCALAR and
+ * arrays of distances can be processed with plain min/plus loops. Addition saturates at the sentinel,
+ * and for signed integers at the lowest value. A finite distance equal to GL_INF(SCALAR) is not representable.
+ *
+ * For other path algebras (see PathAlgebra.hpp), "infinite" stands for ALGEBRA::zero(), the value of no path,
+ * and addition extends a path value by an edge weight. The comparison operators compare the scalar values.
  * @class Distance
  * @brief Implements a numerical distance that supports "infinite distance".
+ * @tparam SCALAR Number type of the distance
+ * @tparam ALGEBRA Path algebra, shortest paths by default
  */
-template <class SCALAR>
+template <class SCALAR, class ALGEBRA = MinPlus<SCALAR>>
 struct Distance
 {
-  Distance () : isInfinite_(true), distance_(0) {}     ///< @brief Default constructor
-  Distance (const SCALAR distance) : isInfinite_(false), distance_(distance) {}                                        ///< @brief Constructor with finite distance
+  constexpr Distance () : distance_(ALGEBRA::zero()) {}            ///< @brief Default constructor
+  constexpr Distance (const SCALAR distance) : distance_(distance) {} ///< @brief Constructor with finite distance
   Distance(const Distance &) = default;                ///< @brief Copy constructor
   Distance(Distance &&) noexcept = default;            ///< @brief Move constructor
   Distance &operator=(const Distance &) = default;     ///< @brief Copy assignment
   Distance &operator=(Distance &&) noexcept = default; ///< @brief Move assignment
   ~Distance() = default;                               ///< @brief Destructor
 
+  /**
+   * @brief Sentinel that encodes an infinite distance in the min-plus algebra.
+   * @return GL_INF(SCALAR)
+   */
+  static constexpr SCALAR infinity()
+  {
+    return GL_INF(SCALAR);
+  }
+  /**
+   * @brief Adds two scalar distances, treating infinity() as an absorbing value.
+   * @param[in] lhs First summand
+   * @param[in] rhs Second summand
+   * @return lhs+rhs, or infinity() if either summand is infinite or the sum overflows.
+   */
+  static constexpr SCALAR saturatingAdd(const SCALAR lhs, const SCALAR rhs)
+  {
+    return MinPlus<SCALAR>::extend(lhs, rhs);
+  }
+
   /**
    * @brief 'equality' operator
    * @param[in] rhs Distance that will get compared
    * @return true if lhs is equal to rhs, false otherwise
    */
-  bool operator == (const Distance& rhs)
+  constexpr bool operator == (const Distance& rhs) const
   {
-    return isInfinite_ == rhs.isInfinite_
-        && distance_ == rhs.distance_;
+    return distance_ == rhs.distance_;
   }
   /**
    * @brief 'inequality' operator
    * @param[in] rhs Distance that will get compared
    * @return true if lhs is not equal to rhs, false otherwise
    */
-  bool operator!= (const Distance& rhs)
+  constexpr bool operator!= (const Distance& rhs) const
   {
-    return !operator==(rhs);
+    return distance_ != rhs.distance_;
   }
   /**
    * @brief 'less than' operator
    * @param[in] rhs Distance that will get compared
    * @return true if lhs is less than rhs, false otherwise
    */
-  bool operator< (const Distance& rhs)
+  constexpr bool operator< (const Distance& rhs) const
   {
-    if (isInfinite_) return false;
-    if (rhs.isInfinite_) return true;
-    if (distance_ < rhs.distance_) return true;
-    return false;
+    return distance_ < rhs.distance_;
   }
   /**
    * @brief 'greater than' operator
    * @param[in] rhs Distance that will get compared
    * @return true if lhs is greater than rhs, false otherwise
    */
-  bool operator> (const Distance& rhs)
+  constexpr bool operator> (const Distance& rhs) const
   {
-    return !operator<(rhs) && operator!=(rhs);
+    return distance_ > rhs.distance_;
   }
   /**
-   * @brief 'addition' operator
+   * @brief 'addition' operator, ALGEBRA::extend()
    * @param[in] rhs Distance that will get added to 'this'
-   * @return Distance with the combined distances.
+   * @return Distance with the combined distances, infinite if either one is infinite.
+   */
+  constexpr Distance operator+ (const Distance& rhs) const
+  {
+    return Distance(ALGEBRA::extend(distance_, rhs.distance_));
+  }
+
+  /**
+   * @brief Smaller of two distances, selected on the scalar values so that min/plus loops can be vectorized.
+   * @param[in] lhs First distance
+   * @param[in] rhs Second distance
+   * @return rhs if it is less than lhs, lhs otherwise.
    */
-  inline Distance operator+ (const Distance& rhs)
+  static constexpr Distance min(const Distance& lhs, const Distance& rhs)
   {
-    Distance res; // set to infinite
-    if (isInfinite_ || rhs.isInfinite_)
-      return res;
-    res.setDistance(distance_+rhs.distance_);
-    return res;
+    return Distance(rhs.distance_ < lhs.distance_ ? rhs.distance_ : lhs.distance_);
   }
 
   /**
@@ -84,12 +118,12 @@ struct Distance
     return std::to_string(distance_);
   }
   /**
-   * @brief Gets the numerical value of the distance. If the distance is infinite, returns the maximum value of the Distance type.
+   * @brief Gets the numerical value of the distance. If the distance is infinite, returns ALGEBRA::zero().
    * @return Scalar type of numerical distance
    */
-  inline SCALAR scalarDistance() const
+  constexpr SCALAR scalarDistance() const
   {
-    return isInfinite_ ? GL_INF(SCALAR) : distance_;
+    return distance_;
   }
   /**
    * @brief Allows updating the distance.
@@ -98,40 +132,40 @@ struct Distance
   inline void setDistance (SCALAR distance)
   {
     distance_ = distance;
-    isInfinite_ = false;
   }
 
   /**
-   * @brief Checks whether the distance is infinite.
+   * @brief Checks whether the distance is infinite, i.e. equal to ALGEBRA::zero().
    * @return true if the distance is infinite, false otherwise
    */
-  inline bool isInfinite() const
+  constexpr bool isInfinite() const
   {
-    return isInfinite_;
+    return distance_ == ALGEBRA::zero();
   }
   /**
-   * @brief Sets the distance to infinity.
+   * @brief Sets the distance to infinity, i.e. to ALGEBRA::zero().
    */
-  inline void setInfinite() const
+  inline void setInfinite()
   {
-    distance_ = 0;
-    isInfinite_ = true;
+    distance_ = ALGEBRA::zero();
   }
 
   /**
    * @brief Checks whether the distance is zero.
    * @return true if the distance is zero, false otherwise
    */
-  inline bool isZero() const
+  constexpr bool isZero() const
   {
-    return !isInfinite() && distance_ == 0;
+    return distance_ == 0;
   }
 
 private:
-  bool isInfinite_;
   SCALAR distance_;
 };
 
+static_assert(sizeof(Distance<int>) == sizeof(int), "Distance must not add storage to its scalar.");
+static_assert(sizeof(Distance<double>) == sizeof(double), "Distance must not add storage to its scalar.");
+
 } // namespace gl
 
-#endif // GL_DISTANCE_HPP
\ No newline at end of file
+#endif // GL_DISTANCE_HPP
@@ -0,0 +1,92 @@
+#ifndef GL_DISTANCE_TABLE_HPP
+#define GL_DISTANCE_TABLE_HPP
+
+#include "../gl_base.hpp"
+#include "Distance.hpp"
+
+#include <vector>
+
+namespace gl
+{
+/**
+ * Row i holds the distances from sources()[i], column j the distances to targets()[j].
+ * The entries are stored row by row in one contiguous array.
+ * @class DistanceTable
+ * @brief Dense table of shortest path lengths between a list of sources and a list of targets.
+ * @tparam SCALAR Number type of the distances.
+ */
+template <class SCALAR>
+class DistanceTable
+{
+public:
+  using val_t = SCALAR;                        ///< Value type
+  using idx_t = gl::index_type;                ///< Index type
+  using idx_list_t = std::vector<idx_t>;       ///< Index List type
+
+  /**
+   * @brief Default constructor. Creates an empty table.
+   */
+  DistanceTable() = default;
+  /**
+   * @brief Creates a table with infinite distances.
+   * @param[in] sources Row nodes
+   * @param[in] targets Column nodes
+   */
+  DistanceTable(const idx_list_t &sources, const idx_list_t &targets)
+    : sources_(sources), targets_(targets), distances_(sources.size() * targets.size()) {}
+
+  DistanceTable(const DistanceTable &) = default;                ///< @brief Copy constructor
+  DistanceTable(DistanceTable &&) noexcept = default;            ///< @brief Move constructor
+  DistanceTable &operator=(const DistanceTable &) = default;     ///< @brief Copy assignment
+  DistanceTable &operator=(DistanceTable &&) noexcept = default; ///< @brief Move assignment
+  ~DistanceTable() = default;                                    ///< @brief Destructor
+
+  /**
+   * @brief Number of rows.
+   * @return Number of sources.
+   */
+  idx_t numSources() const { return sources_.size(); }
+  /**
+   * @brief Number of columns.
+   * @return Number of targets.
+   */
+  idx_t numTargets() const { return targets_.size(); }
+  /**
+   * @brief Row nodes.
+   * @return Sources in row order.
+   */
+  const idx_list_t &sources() const { return sources_; }
+  /**
+   * @brief Column nodes.
+   * @return Targets in column order.
+   */
+  const idx_list_t &targets() const { return targets_; }
+  /**
+   * @brief Distance from sources()[row] to targets()[column].
+   * @param[in] row Row index
+   * @param[in] column Column index
+   * @return Shortest path length, infinite if the target is unreachable.
+   */
+  const Distance<val_t> &operator()(const idx_t row, const idx_t column) const { return distances_[row * targets_.size() + column]; }
+  /**
+   * @brief Distance from sources()[row] to targets()[column].
+   * @param[in] row Row index
+   * @param[in] column Column index
+   * @return Reference to the entry.
+   */
+  Distance<val_t> &operator()(const idx_t row, const idx_t column) { return distances_[row * targets_.size() + column]; }
+  /**
+   * @brief All entries, row by row.
+   * @return Flat array of numSources() * numTargets() distances.
+   */
+  const std::vector<Distance<val_t>> &data() const { return distances_; }
+
+private:
+  idx_list_t sources_;                     ///< @brief Row nodes
+  idx_list_t targets_;                     ///< @brief Column nodes
+  std::vector<Distance<val_t>> distances_; ///< @brief Entries, row by row
+};
+
+} // namespace gl
+
+#endif // GL_DISTANCE_TABLE_HPP
@@ -9,6 +9,7 @@
 #include <vector>
 #include <string>
 #include <queue>
+#include <deque>
 #include <list>
 #include <stack>
 #include <iterator>
@@ -18,6 +19,8 @@
 #include "Edge.hpp"
 #include "Node.hpp"
 #include "Property.hpp"
+#include "LabelIndex.hpp"
+#include "SpatialIndex.hpp"
 #include "../algorithms/HavelHakimi.hpp"
 
 namespace gl {
@@ -42,12 +45,15 @@ class Graph
 public:
   using val_t = SCALAR;                                    ///< Value type
   using idx_t = gl::index_type;                            ///< Index type
+  using storage_t = STORAGE_KIND;                          ///< Storage kind (gl::Matrix or gl::List)
   using Edge = gl::Edge<val_t>;                            ///< Edge type
   using Node = gl::Node<val_t>;                            ///< Node type
   using dest_vec_t = std::vector<std::pair<idx_t, val_t>>; ///< Destination-Vector type
   using idx_list_t = std::vector<idx_t>;                   ///< Index List type
   using ordered_list_t = std::list<idx_t>;                 ///< Ordered List type
   using visit_list_t = std::vector<bool>;                  ///< Visited-List type
+  using generation_t = std::size_t;                        ///< Generation counter type
+  using edge_change_list_t = std::vector<std::pair<idx_t, idx_t>>; ///< Modified-Edges-List type
   template <class info_t>
   using BFS_queue_t = std::deque<info_t>; ///< BFS type
   using DFS_queue_t = std::stack<idx_t>;  ///< DFS type
@@ -257,6 +263,47 @@ protected:
   Property property_; ///< @brief Stores various properties of the Graph.
   std::vector<Node> nodes_;                                                              ///< @brief Stores information about all nodes in the Graph.
   std::conditional_t<std::is_same_v<STORAGE_KIND, Matrix>, matrix_t, rootList_t> edges_; ///< @brief Stores information about all edges in the Graph.
+  /**
+   * Copy and move construction keep the history of the source. Assignment replaces the content of a graph that algorithms
+   * may have seen already, so the target continues with a generation above those of both graphs and with an empty log:
+   * getEdgeChangesSince() then reports a gap for every earlier generation, and cached results get dropped.
+   * The same happens to a graph that has been moved from.
+   * @brief Generation counter and log of the most recent edge modifications.
+   */
+  struct History
+  {
+    generation_t generation = 0;                                            ///< @brief Incremented by every modification of the Graph.
+    generation_t logStart = 0;                                              ///< @brief Generation up to which edge modifications have been dropped from the log.
+    std::deque<std::pair<generation_t, std::pair<idx_t, idx_t>>> log;       ///< @brief Most recent edge modifications, tagged with their generation.
+
+    History() = default;                                                    ///< @brief Default constructor
+    History(const History &) = default;                                     ///< @brief Copy constructor
+    History(History &&rhs) : generation(rhs.generation), logStart(rhs.logStart), log(std::move(rhs.log)) { rhs.restart(*this); } ///< @brief Move constructor
+    History &operator=(const History &rhs) { restart(rhs); return *this; }  ///< @brief Copy assignment
+    History &operator=(History &&rhs) noexcept                              ///< @brief Move assignment
+    {
+      restart(rhs);
+      rhs.restart(*this);
+      return *this;
+    }
+    ~History() = default;                                                   ///< @brief Destructor
+
+    /**
+     * @brief Continues after the generations of this and other, with an empty log.
+     * @param[in] other History whose generations must not be reused
+     */
+    void restart(const History &other) noexcept
+    {
+      generation = std::max(generation, other.generation) + 1;
+      logStart = generation;
+      log.clear();
+    }
+  };
+  History history_;                                                                      ///< @brief Generation and edge modification log.
+  bool hasLabelIndex_ = false;                                                           ///< @brief Whether labelIndex_ is maintained.
+  LabelIndex labelIndex_;                                                                ///< @brief Maps node labels to node IDs (only if hasLabelIndex_).
+  bool hasSpatialIndex_ = false;                                                         ///< @brief Whether spatialIndex_ is maintained.
+  SpatialIndex spatialIndex_;                                                            ///< @brief Grid over node positions (only if hasSpatialIndex_).
 
 public:
   /**
@@ -398,6 +445,7 @@ public:
   inline void setGraphLabel(const std::string &label)
   {
     property_.label(label);
+    ++history_.generation;
   }
   /**
    * @brief Returns the number of nodes currently in the graph.
@@ -416,6 +464,54 @@ public:
   {
     return property_.numEdges();
   }
+  /**
+   * @brief Returns the number of self-loops currently in the graph. O(1).
+   * @return number of self-loops in the graph
+   */
+  inline idx_t numSelfLoops() const
+  {
+    return property_.numSelfLoops();
+  }
+  /**
+   * @brief Returns the number of edges with negative weight (self-loops included). O(1).
+   * @return number of negative edges in the graph
+   */
+  inline idx_t numNegativeEdges() const
+  {
+    return property_.numNegativeEdges();
+  }
+  /**
+   * @brief Returns the number of edges between two different nodes whose weight is zero or negative. O(1).
+   * @return number of non-positive edges in the graph, self-loops excluded
+   */
+  inline idx_t numNonPositiveEdges() const
+  {
+    return property_.numNonPositiveEdges();
+  }
+  /**
+   * @brief Returns the smallest edge weight in the graph. O(1).
+   * @return minimum edge weight, 0 if the graph has no edges
+   */
+  inline val_t minEdgeWeight() const
+  {
+    return static_cast<val_t>(property_.minWeight());
+  }
+  /**
+   * @brief Returns the largest edge weight in the graph. O(1).
+   * @return maximum edge weight, 0 if the graph has no edges
+   */
+  inline val_t maxEdgeWeight() const
+  {
+    return static_cast<val_t>(property_.maxWeight());
+  }
+  /**
+   * @brief Returns the largest out-degree of any node in the graph. O(1).
+   * @return maximum out-degree
+   */
+  inline idx_t maxDegree() const
+  {
+    return property_.maxDegree();
+  }
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
   GL_ENABLE_IF_UNDIRECTED
 #endif
@@ -458,6 +554,37 @@ public:
     return false;
   }
 #endif
+  /**
+   * Cached algorithm results can store the generation they were computed at and compare it later to detect modifications.
+   * Modifications made through the mutable edge_begin()/node_begin() iterators are not tracked.
+   * @brief Returns the generation of the graph, which is incremented by every modification.
+   * @return current generation
+   */
+  inline generation_t generation() const
+  {
+    return history_.generation;
+  }
+  /**
+   * Only the last GL_CHANGE_LOG_CAPACITY edge modifications are remembered.
+   * Edges modified several times are reported several times. Node modifications do not show up here.
+   * For undirected graphs the orientation of a reported pair is unspecified.
+   * @brief Lists the edges that were set, updated or deleted after the given generation.
+   * @param[in] since Generation after which the modifications are of interest.
+   * @return boolean stating whether the log still covers all edge modifications since 'since' & list of the modified (start,end) pairs
+   */
+  std::pair<bool, edge_change_list_t> getEdgeChangesSince(const generation_t &since) const
+  {
+    if (since < history_.logStart)
+      return {false, {}};
+    edge_change_list_t out;
+    for (auto it = std::find_if(history_.log.begin(), history_.log.end(),
+                                [&since](const auto &entry) { return entry.first > since; });
+         it != history_.log.end(); ++it)
+    {
+      out.push_back(it->second);
+    }
+    return {true, out};
+  }
   /**
    * @brief Checks whether the given undirected graph containes cycles using an iterative BFS approach.
    * @return true if cyclic, false if acyclic
@@ -513,8 +640,10 @@ public:
 
     edges_[start].push_back(Edge(start, end, weight, color, true));
     property_.numEdgesIncrement();
-    nodes_[start].outDegreeIncrement();
+    property_.edgeAdded(weight, start == end);
+    outDegreeIncrement(start);
     nodes_[end].inDegreeIncrement();
+    recordEdgeChange(start, end);
   }
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -527,14 +656,16 @@ public:
     GL_ASSERT((!hasEdge(start, end)), std::string("There is already an edge from ") + std::to_string(start) + std::string(" to ") + std::to_string(end));
     edges_[start].push_back(Edge(start, end, weight, color, true));
     property_.numEdgesIncrement();
-    nodes_[start].outDegreeIncrement();
+    property_.edgeAdded(weight, start == end);
+    outDegreeIncrement(start);
     nodes_[end].inDegreeIncrement();
     if (start != end)
     { // for avoiding double-adding self loops
       edges_[end].push_back(Edge(end, start, weight, color, true));
       nodes_[start].inDegreeIncrement();
-      nodes_[end].outDegreeIncrement();
+      outDegreeIncrement(end);
     }
+    recordEdgeChange(start, end);
   }
 
   /**
@@ -548,8 +679,10 @@ public:
     edges_[start * numNodes() + end].exists(true);
     edges_[start * numNodes() + end].color(color);
     property_.numEdgesIncrement();
-    nodes_[start].outDegreeIncrement();
+    property_.edgeAdded(weight, start == end);
+    outDegreeIncrement(start);
     nodes_[end].inDegreeIncrement();
+    recordEdgeChange(start, end);
   }
 
   /**
@@ -567,11 +700,13 @@ public:
     {
       edges_[start * numNodes() + end].exists(true);
       property_.numEdgesIncrement();
+      property_.edgeAdded(weight, start == end);
       nodes_[start].inDegreeIncrement();
-      nodes_[start].outDegreeIncrement();
+      outDegreeIncrement(start);
       nodes_[end].inDegreeIncrement();
-      nodes_[end].outDegreeIncrement();
+      outDegreeIncrement(end);
     }
+    recordEdgeChange(start, end);
   }
 #endif
   /**
@@ -673,33 +808,45 @@ public:
   inline void updateEdge(const idx_t& start, const idx_t& end, const Args&... args)
   {
     GL_ASSERT((hasEdge(start, end)), std::string("No edge from ") + std::to_string(start) + std::string(" to ") + std::to_string(end));
+    const val_t oldWeight = getEdgeWeight(start, end);
     auto it = std::find_if(edges_[start].begin(), edges_[start].end(),
                            [&end](const Edge &node) { return node.dest() == end; });
     updateEdgeInternal(it, args...);
+    property_.edgeWeightChanged(oldWeight, getEdgeWeight(start, end), start == end);
+    recordEdgeChange(start, end);
   }
   template <typename ... Args, typename STORAGE = STORAGE_KIND, typename DIR = DIRECTION, GL_ENABLE_IF_LIST_UNDIRECTED_T>
   inline void updateEdge(const idx_t& start, const idx_t& end, const Args&... args)
   {
     GL_ASSERT((hasEdge(start, end)), std::string("No edge from ") + std::to_string(start) + std::string(" to ") + std::to_string(end));
+    const val_t oldWeight = getEdgeWeight(start, end);
     auto it = std::find_if(edges_[start].begin(), edges_[start].end(),
                            [&end](const Edge &node) { return node.dest() == end; });
     updateEdgeInternal(it, args...);
     it = std::find_if(edges_[end].begin(), edges_[end].end(),
                       [&start](const Edge &node) { return node.dest() == start; });
     updateEdgeInternal(it, args...);
+    property_.edgeWeightChanged(oldWeight, getEdgeWeight(start, end), start == end);
+    recordEdgeChange(start, end);
   }
   template <typename ... Args, typename STORAGE = STORAGE_KIND, typename DIR = DIRECTION, GL_ENABLE_IF_MATRIX_DIRECTED_T>
   inline void updateEdge(const idx_t& start, const idx_t& end, const Args&... args)
   {
     GL_ASSERT((hasEdge(start, end)), std::string("No edge from ") + std::to_string(start) + std::string(" to ") + std::to_string(end));
+    const val_t oldWeight = getEdgeWeight(start, end);
     updateEdgeInternal(edges_.data()+start * numNodes() + end, args...);
+    property_.edgeWeightChanged(oldWeight, getEdgeWeight(start, end), start == end);
+    recordEdgeChange(start, end);
   }
   template <typename ... Args, typename STORAGE = STORAGE_KIND, typename DIR = DIRECTION, GL_ENABLE_IF_MATRIX_UNDIRECTED_T>
   inline void updateEdge(const idx_t& start, const idx_t& end, const Args&... args)
   {
     GL_ASSERT((hasEdge(start, end)), std::string("No edge from ") + std::to_string(start) + std::string(" to ") + std::to_string(end));
+    const val_t oldWeight = getEdgeWeight(start, end);
     updateEdgeInternal(edges_.data()+start * numNodes() + end, args...);
     updateEdgeInternal(edges_.data()+end * numNodes() + start, args...);
+    property_.edgeWeightChanged(oldWeight, getEdgeWeight(start, end), start == end);
+    recordEdgeChange(start, end);
   }
 private:
   template <typename Target, typename First, typename ... OtherArgs>
@@ -743,10 +890,12 @@ public:
     GL_ASSERT((hasEdge(start, end)), std::string("No edge from ") + std::to_string(start) + std::string(" to ") + std::to_string(end));
     auto it = std::find_if(edges_[start].begin(), edges_[start].end(),
                            [&end](const Edge &node) { return node.dest() == end; });
+    property_.edgeRemoved(it->weight(), start == end);
     edges_[start].erase(it);
     property_.numEdgesDecrement();
-    nodes_[start].outDegreeDecrement();
+    outDegreeDecrement(start);
     nodes_[end].inDegreeDecrement();
+    recordEdgeChange(start, end);
   }
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
   /**
@@ -758,18 +907,20 @@ public:
     GL_ASSERT((hasEdge(start, end)), std::string("No edge from ") + std::to_string(start) + std::string(" to ") + std::to_string(end));
     auto it = std::find_if(edges_[start].begin(), edges_[start].end(),
                           [&end](const Edge &node) { return node.dest() == end; });
+    property_.edgeRemoved(it->weight(), start == end);
     edges_[start].erase(it);
     property_.numEdgesDecrement();
     nodes_[start].inDegreeDecrement();
-    nodes_[start].outDegreeDecrement();
+    outDegreeDecrement(start);
     // only do the following if the edge is not a self-loop
     if (start != end) {
       it = std::find_if(edges_[end].begin(), edges_[end].end(),
                         [&start](const Edge &node) { return node.dest() == start; });
       edges_[end].erase(it);
       nodes_[end].inDegreeDecrement();
-      nodes_[end].outDegreeDecrement();
+      outDegreeDecrement(end);
     }
+    recordEdgeChange(start, end);
   }
 
   /**
@@ -780,11 +931,13 @@ public:
   {
     GL_ASSERT((hasEdge(start, end)), std::string("No edge from ") + std::to_string(start) + std::string(" to ") + std::to_string(end));
     checkRange(start, end);
+    property_.edgeRemoved(edges_[start * numNodes() + end].weight(), start == end);
     edges_[start * numNodes() + end].weight(SCALAR(0));
     edges_[start * numNodes() + end].exists(false);
     property_.numEdgesDecrement();
-    nodes_[start].outDegreeDecrement();
+    outDegreeDecrement(start);
     nodes_[end].inDegreeDecrement();
+    recordEdgeChange(start, end);
   }
 
   /**
@@ -796,13 +949,15 @@ public:
     GL_ASSERT((hasEdge(start, end)), std::string("No edge from ") + std::to_string(start) + std::string(" to ") + std::to_string(end));
     if (start > end)
       std::swap(end, start);
+    property_.edgeRemoved(edges_[start * numNodes() + end].weight(), start == end);
     edges_[start * numNodes() + end].weight(SCALAR(0));
     edges_[start * numNodes() + end].exists(false);
     property_.numEdgesDecrement();
     nodes_[start].inDegreeDecrement();
-    nodes_[start].outDegreeDecrement();
+    outDegreeDecrement(start);
     nodes_[end].inDegreeDecrement();
-    nodes_[end].outDegreeDecrement();
+    outDegreeDecrement(end);
+    recordEdgeChange(start, end);
   }
 #endif
 
@@ -1145,14 +1300,74 @@ public:
   dest_vec_t getNeighbourWeights(const idx_t &node) const
   {
     dest_vec_t out;
+    getNeighbourWeights(node, out);
+    return out;
+  }
+#endif
+  /**
+   * Same as getNeighbourWeights(node), but reuses the memory of out. Meant for hot loops that visit many nodes.
+   * @brief Writes the endpoints + edge weights of outgoing edges from start into out.
+   * @param[in] node edge origin point
+   * @param[out] out List of all direct neighbours + weights (previous content is discarded)
+   */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  GL_ENABLE_IF_LIST
+#endif
+  void getNeighbourWeights(const idx_t &node, dest_vec_t &out) const
+  {
+    out.clear();
+    for (const auto &edge : edges_[node])
+    {
+      out.emplace_back(edge.dest(), edge.weight());
+    }
+  }
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  /**
+   * @brief Writes list & weights of outgoing edges in a Matrix Graph into out.
+   */
+  GL_ENABLE_IF_MATRIX
+  void getNeighbourWeights(const idx_t &node, dest_vec_t &out) const
+  {
+    out.clear();
     for (idx_t end = 0; end < numNodes(); ++end)
     {
-      if (hasEdge(node, end))
-        out.push_back(std::make_pair(end, getEdgeWeight(node, end)));
+      const Edge &edge = matrixCell(node, end);
+      if (edge.exists())
+        out.emplace_back(end, edge.weight());
     }
-    return out;
   }
 #endif
+  /**
+   * Cell end of the row holds the edge from start to end, cells without an edge have exists() == false.
+   * Undirected graphs only store the upper triangle: there, the row of start holds the edges to end >= start,
+   * and the edge to end < start is cell start of the row of end.
+   * Meant for dense algorithms that scan whole rows. This function only exists for MatrixGraphs.
+   * @brief Direct access to the row of start in the adjacency matrix.
+   * @param[in] start edge origin point
+   * @return Pointer to numNodes() consecutive edges.
+   */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  GL_ENABLE_IF_MATRIX
+#endif
+  const Edge *getEdgeRow(const idx_t &start) const
+  {
+    checkRange(start);
+    return edges_.data() + start * numNodes();
+  }
+
+private:
+  /**
+   * @brief Matrix cell of the edge start->end without range checks, taking the triangular storage of undirected graphs into account.
+   */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  GL_ENABLE_IF_MATRIX
+#endif
+  const Edge &matrixCell(const idx_t &start, const idx_t &end) const
+  {
+    return (isDirected() || start <= end) ? edges_[start * numNodes() + end] : edges_[end * numNodes() + start];
+  }
+
+public:
   /**
    * @brief Returns a list of endpoints + edge weights of unvisited outgoing edges from start.
    * @param[in] node edge origin point
@@ -1182,8 +1397,9 @@ public:
     dest_vec_t out;
     for (idx_t end = 0; end < numNodes(); ++end)
     {
-      if (hasEdge(node, end) && !visited[end])
-        out.push_back(std::make_pair(end, getEdgeWeight(node, end)));
+      const Edge &edge = matrixCell(node, end);
+      if (edge.exists() && !visited[end])
+        out.emplace_back(end, edge.weight());
     }
     return out;
   }
@@ -1216,30 +1432,41 @@ public:
   template <typename ... OtherArgs>
   inline void updateNode (const idx_t& id, const std::string& arg, const OtherArgs&... rest) 
   {
+    if (hasLabelIndex_)
+      labelIndex_.update(id, nodes_[id].label(), arg);
     nodes_[id].label(arg);
+    ++history_.generation;
     updateNode(id, rest...);
   }template <typename ... OtherArgs>
   inline void updateNode (const idx_t& id, const char* arg, const OtherArgs&... rest) 
   {
+    if (hasLabelIndex_)
+      labelIndex_.update(id, nodes_[id].label(), arg);
     nodes_[id].label(arg);
+    ++history_.generation;
     updateNode(id, rest...);
   }
   template <typename ... OtherArgs>
   inline void updateNode (const idx_t& id, const val_t& arg, const OtherArgs&... rest) 
   {
     nodes_[id].capacity(arg);
+    ++history_.generation;
     updateNode(id, rest...);
   }
   template <typename ... OtherArgs>
   inline void updateNode (const idx_t& id, const gl::Color& arg, const OtherArgs&... rest) 
   {
     nodes_[id].color(arg);
+    ++history_.generation;
     updateNode(id, rest...);
   }
   template <typename ... OtherArgs>
   inline void updateNode (const idx_t& id, const std::pair<float,float>& arg, const OtherArgs&... rest) 
   {
     nodes_[id].position(arg);
+    if (hasSpatialIndex_)
+      spatialIndex_.update(id, arg);
+    ++history_.generation;
     updateNode(id, rest...);
   }
   inline void updateNode (const idx_t& id) 
@@ -1256,6 +1483,68 @@ public:
   {
     return nodes_[id].label();
   }
+  /**
+   * Afterwards findNode() runs in O(1) and findNodesWithPrefix() in O(log V + k).
+   * The index is kept in sync by updateNode(); labels changed through node_begin() are not tracked.
+   * @brief Builds an index from node labels to node IDs. O(V log V).
+   */
+  void enableLabelIndex()
+  {
+    labelIndex_.clear();
+    for (idx_t id = 0; id < numNodes(); ++id)
+      labelIndex_.insert(nodes_[id].label(), id);
+    hasLabelIndex_ = true;
+  }
+  /**
+   * @brief Drops the label index and frees its memory.
+   */
+  void disableLabelIndex()
+  {
+    labelIndex_ = LabelIndex();
+    hasLabelIndex_ = false;
+  }
+  /**
+   * @brief Checks whether node labels are indexed.
+   * @return true if enableLabelIndex() is active, false otherwise.
+   */
+  inline bool hasLabelIndex() const
+  {
+    return hasLabelIndex_;
+  }
+  /**
+   * If several nodes share the label, the one with the smallest ID is returned.
+   * @brief Finds a node by its label. O(1) with a label index, O(V) otherwise.
+   * @param[in] label Label to look for.
+   * @return pair of (true, node ID) if found, (false, 0) otherwise.
+   */
+  std::pair<bool, idx_t> findNode(const std::string &label) const
+  {
+    if (hasLabelIndex_)
+      return labelIndex_.find(label);
+    for (idx_t id = 0; id < numNodes(); ++id)
+      if (nodes_[id].label() == label)
+        return {true, id};
+    return {false, 0};
+  }
+  /**
+   * @brief Finds all nodes whose label starts with prefix. O(log V + k) with a label index, O(V) otherwise.
+   * @param[in] prefix Prefix to look for.
+   * @return IDs of all matching nodes, ordered by label and then by ID.
+   */
+  std::vector<idx_t> findNodesWithPrefix(const std::string &prefix) const
+  {
+    if (hasLabelIndex_)
+      return labelIndex_.findPrefix(prefix);
+    std::vector<std::pair<std::string, idx_t>> matches;
+    for (idx_t id = 0; id < numNodes(); ++id)
+      if (nodes_[id].label().compare(0, prefix.size(), prefix) == 0)
+        matches.emplace_back(nodes_[id].label(), id);
+    std::sort(matches.begin(), matches.end());
+    std::vector<idx_t> out;
+    for (const auto &match : matches)
+      out.push_back(match.second);
+    return out;
+  }
   /**
    * @brief Finds the flow capacity of the given node.
    * @param[in] id node whose flow capacity is to be found
@@ -1274,6 +1563,79 @@ public:
   {
     return nodes_[id].position();
   }
+  /**
+   * Afterwards findNearestNodes() and findNodesInRange() only look at nodes close to the query.
+   * The index is kept in sync by updateNode(); positions changed through node_begin() are not tracked.
+   * @brief Builds a spatial index over the node positions. O(V).
+   */
+  void enableSpatialIndex()
+  {
+    std::vector<std::pair<float, float>> positions;
+    positions.reserve(numNodes());
+    for (const auto &node : nodes_)
+      positions.push_back(node.position());
+    spatialIndex_.build(positions);
+    hasSpatialIndex_ = true;
+  }
+  /**
+   * @brief Drops the spatial index and frees its memory.
+   */
+  void disableSpatialIndex()
+  {
+    spatialIndex_ = SpatialIndex();
+    hasSpatialIndex_ = false;
+  }
+  /**
+   * @brief Checks whether node positions are indexed.
+   * @return true if enableSpatialIndex() is active, false otherwise.
+   */
+  inline bool hasSpatialIndex() const
+  {
+    return hasSpatialIndex_;
+  }
+  /**
+   * @brief Finds the k nodes closest to a position. Uses the spatial index if enabled, O(V log k) otherwise.
+   * @param[in] position Query position.
+   * @param[in] k Number of nodes to find.
+   * @return IDs of the min(k,V) closest nodes, ordered by Euclidean distance and then by ID.
+   */
+  std::vector<idx_t> findNearestNodes(const std::pair<float, float> &position, const idx_t &k = 1) const
+  {
+    if (hasSpatialIndex_)
+      return spatialIndex_.nearest(position, k);
+    std::vector<std::pair<double, idx_t>> distances;
+    for (idx_t id = 0; id < numNodes(); ++id)
+    {
+      double dx = double(nodes_[id].position().first) - position.first;
+      double dy = double(nodes_[id].position().second) - position.second;
+      distances.emplace_back(dx * dx + dy * dy, id);
+    }
+    idx_t count = std::min(k, numNodes());
+    std::partial_sort(distances.begin(), distances.begin() + count, distances.end());
+    std::vector<idx_t> out;
+    for (idx_t i = 0; i < count; ++i)
+      out.push_back(distances[i].second);
+    return out;
+  }
+  /**
+   * @brief Finds all nodes inside an axis-aligned box (borders included). Uses the spatial index if enabled, O(V) otherwise.
+   * @param[in] lower Lower left corner of the box.
+   * @param[in] upper Upper right corner of the box.
+   * @return IDs of the nodes inside the box in ascending order.
+   */
+  std::vector<idx_t> findNodesInRange(const std::pair<float, float> &lower, const std::pair<float, float> &upper) const
+  {
+    if (hasSpatialIndex_)
+      return spatialIndex_.range(lower, upper);
+    std::vector<idx_t> out;
+    for (idx_t id = 0; id < numNodes(); ++id)
+    {
+      auto p = nodes_[id].position();
+      if (p.first >= lower.first && p.first <= upper.first && p.second >= lower.second && p.second <= upper.second)
+        out.push_back(id);
+    }
+    return out;
+  }
   /**
    * @brief Finds the degree of the given node (i.e. count of all in- & outgoing edges).
    * @param[in] id node whose degree is to be found
@@ -1448,6 +1810,38 @@ public:
   ///////////////////////////////////////////////////////////
 
 private:
+  /**
+   * @brief Auxiliary function. Increments the out-degree of a node and updates the degree statistics.
+   * @param[in] node ID of the node
+   */
+  void outDegreeIncrement(const idx_t &node)
+  {
+    property_.degreeChanged(nodes_[node].outDegree(), nodes_[node].outDegree() + 1);
+    nodes_[node].outDegreeIncrement();
+  }
+  /**
+   * @brief Auxiliary function. Decrements the out-degree of a node and updates the degree statistics.
+   * @param[in] node ID of the node
+   */
+  void outDegreeDecrement(const idx_t &node)
+  {
+    nodes_[node].outDegreeDecrement();
+    property_.degreeChanged(nodes_[node].outDegree() + 1, nodes_[node].outDegree());
+  }
+  /**
+   * @brief Auxiliary function. Advances the generation and remembers the modified edge.
+   * @param[in] start edge origin point
+   * @param[in] end edge end point
+   */
+  void recordEdgeChange(const idx_t &start, const idx_t &end)
+  {
+    history_.log.emplace_back(++history_.generation, std::make_pair(start, end));
+    while (history_.log.size() > GL_CHANGE_LOG_CAPACITY)
+    {
+      history_.logStart = history_.log.front().first;
+      history_.log.pop_front();
+    }
+  }
   /**
    * @brief Auxiliary function. Creates an empty Graph using the deduced storage format.
    */
@@ -1467,7 +1861,6 @@ private:
       }
     }
     edges_ = matrix;
-    std::vector<Node> nodes();
     for (idx_t i = 0; i < numNodes(); ++i)
     {
       nodes_.push_back(Node(i));
@@ -1483,7 +1876,6 @@ private:
   {
     rootList_t list(numNodes());
     edges_ = list;
-    std::vector<Node> nodes();
     for (idx_t i = 0; i < numNodes(); ++i)
     {
       nodes_.push_back(Node(i));
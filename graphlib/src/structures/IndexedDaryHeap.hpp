@@ -0,0 +1,232 @@
+#ifndef GL_INDEXED_DARY_HEAP_HPP
+#define GL_INDEXED_DARY_HEAP_HPP
+
+#include "../gl_base.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+/**
+ * Every node is contained at most once: instead of pushing duplicates, the key of a queued node is decreased in place.
+ * The heap holds at most one entry per node, no matter how many edges are relaxed.
+ * Keys and node IDs are kept in two flat arrays in heap order, and position_ maps a node to its heap slot.
+ * A larger arity gives a shallower heap (cheaper decrease-key) at the price of more comparisons per pop.
+ * @class IndexedDaryHeap
+ * @brief Position-indexed d-ary min-heap over node IDs with decrease-key.
+ * @tparam KEY Key type, compared with operator<.
+ * @tparam ARITY Number of children per heap node (at least 2).
+ */
+template <class KEY, unsigned ARITY = 4>
+class IndexedDaryHeap
+{
+  static_assert(ARITY >= 2, "IndexedDaryHeap | The arity has to be at least 2.");
+
+public:
+  using key_t = KEY;                        ///< Key type
+  using idx_t = gl::index_type;             ///< Index type
+  using entry_t = std::pair<key_t, idx_t>;  ///< (key, node) pair
+
+  /**
+   * @brief Default constructor. Creates a heap for 0 nodes.
+   */
+  IndexedDaryHeap() = default;
+  /**
+   * @brief Creates an empty heap for the nodes 0 to numNodes-1.
+   * @param[in] numNodes Number of nodes
+   */
+  explicit IndexedDaryHeap(const idx_t numNodes) { resize(numNodes); }
+
+  IndexedDaryHeap(const IndexedDaryHeap &) = default;                ///< @brief Copy constructor
+  IndexedDaryHeap(IndexedDaryHeap &&) noexcept = default;            ///< @brief Move constructor
+  IndexedDaryHeap &operator=(const IndexedDaryHeap &) = default;     ///< @brief Copy assignment
+  IndexedDaryHeap &operator=(IndexedDaryHeap &&) noexcept = default; ///< @brief Move assignment
+  ~IndexedDaryHeap() = default;                                      ///< @brief Destructor
+
+  /**
+   * @brief Empties the heap and sets the number of nodes. O(numNodes).
+   * @param[in] numNodes Number of nodes
+   */
+  void resize(const idx_t numNodes);
+  /**
+   * @brief Removes all entries. O(size).
+   */
+  void clear();
+  /**
+   * @brief Checks whether the heap is empty.
+   * @return true if no node is queued.
+   */
+  bool empty() const { return nodes_.empty(); }
+  /**
+   * @brief Number of queued nodes.
+   * @return Heap size.
+   */
+  idx_t size() const { return nodes_.size(); }
+  /**
+   * @brief Checks whether a node is queued.
+   * @param[in] node Node ID
+   * @return true if the node is in the heap.
+   */
+  bool contains(const idx_t node) const { return position_[node] != npos; }
+  /**
+   * @warning Only meaningful if contains(node) is true.
+   * @brief Key of a queued node.
+   * @param[in] node Node ID
+   * @return Current key.
+   */
+  key_t key(const idx_t node) const { return keys_[position_[node]]; }
+  /**
+   * @warning The node must not be queued.
+   * @brief Inserts a node. O(log_d n).
+   * @param[in] node Node ID
+   * @param[in] key Key of the node
+   */
+  void push(const idx_t node, const key_t key);
+  /**
+   * @warning The node must be queued and key must not be larger than its current key.
+   * @brief Lowers the key of a queued node. O(log_d n).
+   * @param[in] node Node ID
+   * @param[in] key New key
+   */
+  void decrease(const idx_t node, const key_t key);
+  /**
+   * @brief Inserts a node or lowers its key if the new key is smaller.
+   * @param[in] node Node ID
+   * @param[in] key Candidate key
+   * @return true if the node was inserted or its key was lowered.
+   */
+  bool pushOrDecrease(const idx_t node, const key_t key);
+  /**
+   * @warning The heap must not be empty.
+   * @brief Entry with the smallest key.
+   * @return (key, node) pair
+   */
+  entry_t top() const { return {keys_.front(), nodes_.front()}; }
+  /**
+   * @warning The heap must not be empty.
+   * @brief Removes and returns the entry with the smallest key. O(d log_d n).
+   * @return (key, node) pair
+   */
+  entry_t pop();
+
+private:
+  static constexpr idx_t npos = GL_INF(idx_t); ///< @brief Position of nodes that are not queued
+
+  /**
+   * @brief Moves the entry at pos up until its parent is not larger.
+   */
+  void siftUp(idx_t pos, const key_t key, const idx_t node);
+  /**
+   * @brief Moves the entry at pos down until no child is smaller.
+   */
+  void siftDown(idx_t pos, const key_t key, const idx_t node);
+
+  std::vector<key_t> keys_;      ///< @brief Keys in heap order
+  std::vector<idx_t> nodes_;     ///< @brief Node IDs in heap order
+  std::vector<idx_t> position_;  ///< @brief Heap slot of every node, npos if not queued
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class KEY, unsigned ARITY>
+void IndexedDaryHeap<KEY, ARITY>::resize(const idx_t numNodes)
+{
+  keys_.clear();
+  nodes_.clear();
+  position_.assign(numNodes, npos);
+}
+
+template <class KEY, unsigned ARITY>
+void IndexedDaryHeap<KEY, ARITY>::clear()
+{
+  for (auto node : nodes_)
+    position_[node] = npos;
+  keys_.clear();
+  nodes_.clear();
+}
+
+template <class KEY, unsigned ARITY>
+void IndexedDaryHeap<KEY, ARITY>::push(const idx_t node, const key_t key)
+{
+  keys_.push_back(key);
+  nodes_.push_back(node);
+  siftUp(nodes_.size() - 1, key, node);
+}
+
+template <class KEY, unsigned ARITY>
+void IndexedDaryHeap<KEY, ARITY>::decrease(const idx_t node, const key_t key)
+{
+  siftUp(position_[node], key, node);
+}
+
+template <class KEY, unsigned ARITY>
+bool IndexedDaryHeap<KEY, ARITY>::pushOrDecrease(const idx_t node, const key_t key)
+{
+  if (!contains(node))
+    push(node, key);
+  else if (key < keys_[position_[node]])
+    decrease(node, key);
+  else
+    return false;
+  return true;
+}
+
+template <class KEY, unsigned ARITY>
+typename IndexedDaryHeap<KEY, ARITY>::entry_t IndexedDaryHeap<KEY, ARITY>::pop()
+{
+  entry_t out {keys_.front(), nodes_.front()};
+  position_[out.second] = npos;
+  key_t lastKey = keys_.back();
+  idx_t lastNode = nodes_.back();
+  keys_.pop_back();
+  nodes_.pop_back();
+  if (!nodes_.empty())
+    siftDown(0, lastKey, lastNode);
+  return out;
+}
+
+template <class KEY, unsigned ARITY>
+void IndexedDaryHeap<KEY, ARITY>::siftUp(idx_t pos, const key_t key, const idx_t node)
+{
+  // move the parents down instead of swapping, the entry is written once at its final slot
+  while (pos > 0) {
+    idx_t parent = (pos - 1) / ARITY;
+    if (!(key < keys_[parent])) break;
+    keys_[pos] = keys_[parent];
+    nodes_[pos] = nodes_[parent];
+    position_[nodes_[pos]] = pos;
+    pos = parent;
+  }
+  keys_[pos] = key;
+  nodes_[pos] = node;
+  position_[node] = pos;
+}
+
+template <class KEY, unsigned ARITY>
+void IndexedDaryHeap<KEY, ARITY>::siftDown(idx_t pos, const key_t key, const idx_t node)
+{
+  const idx_t size = nodes_.size();
+  for (;;) {
+    idx_t first = pos * ARITY + 1;
+    if (first >= size) break;
+    idx_t last = first + ARITY < size ? first + ARITY : size;
+    idx_t smallest = first;
+    for (idx_t child = first + 1; child < last; ++child)
+      if (keys_[child] < keys_[smallest]) smallest = child;
+    if (!(keys_[smallest] < key)) break;
+    keys_[pos] = keys_[smallest];
+    nodes_[pos] = nodes_[smallest];
+    position_[nodes_[pos]] = pos;
+    pos = smallest;
+  }
+  keys_[pos] = key;
+  nodes_[pos] = node;
+  position_[node] = pos;
+}
+
+} // namespace gl
+
+#endif // GL_INDEXED_DARY_HEAP_HPP
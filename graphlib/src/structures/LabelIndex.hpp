@@ -0,0 +1,136 @@
+#ifndef GL_LABEL_INDEX_HPP
+#define GL_LABEL_INDEX_HPP
+
+#include "../gl_base.hpp"
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+/**
+ * Exact lookups are answered by a hash map in O(1), prefix lookups by an ordered set in O(log n + k).
+ * Several nodes may share a label; an exact lookup then yields the one with the smallest ID.
+ * @class LabelIndex
+ * @brief Maps node labels to node IDs.
+ */
+class LabelIndex {
+using idx_t = gl::index_type;
+public:
+  /**
+   * @brief Default constructor. Creates an empty index.
+   */
+  LabelIndex() = default;
+  // other constructors
+  LabelIndex(const LabelIndex &) = default;                ///< @brief Copy constructor
+  LabelIndex(LabelIndex &&) noexcept = default;            ///< @brief Move constructor
+  LabelIndex &operator=(const LabelIndex &) = default;     ///< @brief Copy assignment
+  LabelIndex &operator=(LabelIndex &&) noexcept = default; ///< @brief Move assignment
+  ~LabelIndex() = default;                                 ///< @brief Destructor
+  /**
+   * @brief Adds a node to the index.
+   * @param[in] label Label of the node.
+   * @param[in] id ID of the node.
+   */
+  void insert (const std::string& label, idx_t id);
+  /**
+   * @brief Removes a node from the index.
+   * @param[in] label Label under which the node was inserted.
+   * @param[in] id ID of the node.
+   */
+  void erase (const std::string& label, idx_t id);
+  /**
+   * @brief Moves a node to a new label.
+   * @param[in] id ID of the node.
+   * @param[in] oldLabel Label under which the node was inserted.
+   * @param[in] newLabel New label of the node.
+   */
+  void update (idx_t id, const std::string& oldLabel, const std::string& newLabel);
+  /**
+   * @brief Finds the node with the given label. O(1) on average.
+   * @param[in] label Label to look for.
+   * @return pair of (true, smallest ID with that label) if found, (false, 0) otherwise.
+   */
+  std::pair<bool,idx_t> find (const std::string& label) const;
+  /**
+   * @brief Finds all nodes whose label starts with the given prefix. O(log n + k).
+   * @param[in] prefix Prefix to look for.
+   * @return IDs of the matching nodes, ordered by label and then by ID.
+   */
+  std::vector<idx_t> findPrefix (const std::string& prefix) const;
+  /**
+   * @brief Returns the number of indexed nodes.
+   * @return Number of (label, ID) entries.
+   */
+  idx_t size () const;
+  /**
+   * @brief Removes all entries.
+   */
+  void clear ();
+
+private:
+  std::unordered_map<std::string,idx_t> exact_;     ///< Smallest ID per label.
+  std::set<std::pair<std::string,idx_t>> ordered_;  ///< All entries, sorted by label and ID.
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+inline void LabelIndex::insert (const std::string& label, idx_t id) {
+  ordered_.emplace(label,id);
+  auto it = exact_.find(label);
+  if (it == exact_.end())
+    exact_.emplace(label,id);
+  else if (id < it->second)
+    it->second = id;
+}
+
+inline void LabelIndex::erase (const std::string& label, idx_t id) {
+  GL_ASSERT(ordered_.erase(std::make_pair(label,id)) == 1,std::string("LabelIndex::erase | Node ")+std::to_string(id)+std::string(" is not indexed under label \"")+label+std::string("\""))
+  auto it = exact_.find(label);
+  if (it->second != id) return;
+  // promote the next node with the same label, if any
+  auto next = ordered_.lower_bound(std::make_pair(label,idx_t(0)));
+  if (next != ordered_.end() && next->first == label)
+    it->second = next->second;
+  else
+    exact_.erase(it);
+}
+
+inline void LabelIndex::update (idx_t id, const std::string& oldLabel, const std::string& newLabel) {
+  if (oldLabel == newLabel) return;
+  erase(oldLabel,id);
+  insert(newLabel,id);
+}
+
+inline std::pair<bool,typename LabelIndex::idx_t> LabelIndex::find (const std::string& label) const {
+  auto it = exact_.find(label);
+  if (it == exact_.end()) return {false,0};
+  return {true,it->second};
+}
+
+inline std::vector<typename LabelIndex::idx_t> LabelIndex::findPrefix (const std::string& prefix) const {
+  std::vector<idx_t> out;
+  for (auto it = ordered_.lower_bound(std::make_pair(prefix,idx_t(0))); it != ordered_.end(); ++it) {
+    if (it->first.compare(0,prefix.size(),prefix) != 0) break;
+    out.push_back(it->second);
+  }
+  return out;
+}
+
+inline typename LabelIndex::idx_t LabelIndex::size () const {
+  return ordered_.size();
+}
+
+inline void LabelIndex::clear () {
+  exact_.clear();
+  ordered_.clear();
+}
+
+} // namespace gl
+
+#endif // GL_LABEL_INDEX_HPP
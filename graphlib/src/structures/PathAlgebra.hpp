@@ -0,0 +1,196 @@
+#ifndef GL_PATH_ALGEBRA_HPP
+#define GL_PATH_ALGEBRA_HPP
+
+#include "../gl_base.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace gl
+{
+/**
+ * A path algebra defines the value of a path from the values of its edges, and which of two path values is preferred.
+ * It is passed as a template parameter, so every search is compiled for one algebra and the operations are inlined.
+ * Every algebra provides:
+ * - zero(): value of "no path", never preferred and absorbing under extend()
+ * - one(): value of the empty path, neutral under extend()
+ * - extend(value, weight): value of a path extended by an edge
+ * - better(lhs, rhs): true if lhs is strictly preferred over rhs
+ * - priority(value): queue key that is smaller for preferred values, and less than GL_INF for every value but zero()
+ * - admits(graph): whether label-setting searches (Dijkstra) are exact, i.e. no edge makes a path more preferable
+ * - inadmissibleWeights(): error message if admits() fails
+ * @class MinPlus
+ * @brief Shortest paths: path lengths are sums of edge weights, shorter is preferred.
+ * @tparam SCALAR Number type of the edge weights
+ */
+template <class SCALAR>
+struct MinPlus
+{
+  using val_t = SCALAR; ///< Value type
+
+  /**
+   * @brief Value of "no path", infinity.
+   * @return GL_INF(SCALAR)
+   */
+  static constexpr SCALAR zero() { return GL_INF(SCALAR); }
+  /**
+   * @brief Value of the empty path.
+   * @return 0
+   */
+  static constexpr SCALAR one() { return SCALAR(0); }
+  /**
+   * The sum saturates at zero(), and for signed integers at the lowest value.
+   * @brief Adds an edge weight to a path length.
+   * @param[in] value Path length
+   * @param[in] weight Edge weight
+   * @return value+weight, or zero() if either summand is infinite or the sum overflows.
+   */
+  static constexpr SCALAR extend(const SCALAR value, const SCALAR weight)
+  {
+    // selects instead of early returns, so that loops over distance arrays can be vectorized
+    const bool infinite = (value == zero()) | (weight == zero());
+    if constexpr (std::is_integral_v<SCALAR> && std::is_signed_v<SCALAR>) {
+      using unsigned_t = std::make_unsigned_t<SCALAR>;
+      const SCALAR sum = static_cast<SCALAR>(static_cast<unsigned_t>(value) + static_cast<unsigned_t>(weight));
+      const bool overflow = ((value ^ sum) & (weight ^ sum)) < 0;
+      const SCALAR bound = weight > 0 ? zero() : std::numeric_limits<SCALAR>::lowest();
+      return infinite ? zero() : (overflow ? bound : sum);
+    } else if constexpr (std::is_integral_v<SCALAR>) {
+      const SCALAR sum = value + weight;
+      return (infinite | (sum < value)) ? zero() : sum;
+    } else {
+      const SCALAR sum = value + weight;
+      return (infinite | !(sum < zero())) ? zero() : sum;
+    }
+  }
+  /**
+   * @brief Compares two path lengths.
+   * @return true if lhs is shorter than rhs.
+   */
+  static constexpr bool better(const SCALAR lhs, const SCALAR rhs) { return lhs < rhs; }
+  /**
+   * @brief Queue key of a path length.
+   * @return The length itself.
+   */
+  static constexpr SCALAR priority(const SCALAR value) { return value; }
+  /**
+   * @brief Checks whether all edge weights are positive. O(1).
+   * @return true if Dijkstra computes exact shortest paths on graph.
+   */
+  template <class Graph>
+  static bool admits(const Graph& graph) { return graph.numNonPositiveEdges() == 0; }
+  /**
+   * @brief Error message for graphs that are not admitted.
+   * @return Message
+   */
+  static constexpr const char* inadmissibleWeights() { return "Found non-positive edge weights in the graph."; }
+};
+
+/**
+ * Edge weights are capacities, the value of a path is its smallest capacity. Any weights are admitted.
+ * @class MaxMin
+ * @brief Widest (bottleneck) paths: the path with the largest minimal edge weight is preferred.
+ * @tparam SCALAR Number type of the edge weights
+ */
+template <class SCALAR>
+struct MaxMin
+{
+  using val_t = SCALAR; ///< Value type
+
+  /**
+   * @brief Value of "no path".
+   * @return Lowest value of SCALAR
+   */
+  static constexpr SCALAR zero() { return std::numeric_limits<SCALAR>::lowest(); }
+  /**
+   * @brief Value of the empty path, an unlimited capacity.
+   * @return GL_INF(SCALAR)
+   */
+  static constexpr SCALAR one() { return GL_INF(SCALAR); }
+  /**
+   * @brief Limits a path capacity by an edge capacity.
+   * @return min(value, weight)
+   */
+  static constexpr SCALAR extend(const SCALAR value, const SCALAR weight) { return weight < value ? weight : value; }
+  /**
+   * @brief Compares two path capacities.
+   * @return true if lhs is wider than rhs.
+   */
+  static constexpr bool better(const SCALAR lhs, const SCALAR rhs) { return rhs < lhs; }
+  /**
+   * @brief Queue key of a path capacity, order reversing.
+   * @return ~value for integers, -value otherwise.
+   */
+  static constexpr SCALAR priority(const SCALAR value)
+  {
+    if constexpr (std::is_integral_v<SCALAR>)
+      return ~value;
+    else
+      return -value;
+  }
+  /**
+   * @brief Extending a path never widens it.
+   * @return true
+   */
+  template <class Graph>
+  static bool admits(const Graph&) { return true; }
+  /**
+   * @brief Error message for graphs that are not admitted.
+   * @return Message
+   */
+  static constexpr const char* inadmissibleWeights() { return ""; }
+};
+
+/**
+ * Edge weights are probabilities in [0,1], the value of a path is their product.
+ * @class MaxProduct
+ * @brief Most reliable paths: the path with the largest product of edge weights is preferred.
+ * @tparam SCALAR Floating point type of the edge weights
+ */
+template <class SCALAR>
+struct MaxProduct
+{
+  static_assert(std::is_floating_point_v<SCALAR>, "MaxProduct | Edge weights have to be floating point probabilities.");
+  using val_t = SCALAR; ///< Value type
+
+  /**
+   * @brief Value of "no path".
+   * @return 0
+   */
+  static constexpr SCALAR zero() { return SCALAR(0); }
+  /**
+   * @brief Value of the empty path.
+   * @return 1
+   */
+  static constexpr SCALAR one() { return SCALAR(1); }
+  /**
+   * @brief Multiplies a path probability by an edge probability.
+   * @return value*weight
+   */
+  static constexpr SCALAR extend(const SCALAR value, const SCALAR weight) { return value * weight; }
+  /**
+   * @brief Compares two path probabilities.
+   * @return true if lhs is more reliable than rhs.
+   */
+  static constexpr bool better(const SCALAR lhs, const SCALAR rhs) { return rhs < lhs; }
+  /**
+   * @brief Queue key of a path probability, order reversing.
+   * @return -value
+   */
+  static constexpr SCALAR priority(const SCALAR value) { return -value; }
+  /**
+   * @brief Checks whether all edge weights lie in [0,1]. O(1).
+   * @return true if Dijkstra computes exact most reliable paths on graph.
+   */
+  template <class Graph>
+  static bool admits(const Graph& graph) { return graph.numNegativeEdges() == 0 && !(SCALAR(1) < graph.maxEdgeWeight()); }
+  /**
+   * @brief Error message for graphs that are not admitted.
+   * @return Message
+   */
+  static constexpr const char* inadmissibleWeights() { return "Found edge weights outside of [0,1] in the graph."; }
+};
+
+} // namespace gl
+
+#endif // GL_PATH_ALGEBRA_HPP
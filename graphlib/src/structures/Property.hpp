@@ -1,6 +1,9 @@
 #ifndef GL_PROPERTY_HPP
 #define GL_PROPERTY_HPP
 
+#include <map>
+#include <vector>
+
 namespace gl {
 
 ///////////////////////////////////////////////////////////
@@ -8,6 +11,8 @@ namespace gl {
 ///////////////////////////////////////////////////////////
 
 /** 
+ * Besides label and size, a Property keeps statistics about the edges (weight range, negative weights, self-loops, degrees).
+ * They are updated incrementally by the Graph on every edge modification, so algorithms can query them in O(1).
  * @class Property
  * @brief Stores the properties of a Graph.
  */
@@ -16,7 +21,8 @@ class Property
 public:
   using idx_t = gl::index_type;
 
-  Property(const idx_t &numNodes = 0, const std::string &label = "Graph") : numNodes_(numNodes), label_(label), numEdges_(0) {}
+  Property(const idx_t &numNodes = 0, const std::string &label = "Graph") : numNodes_(numNodes), label_(label), numEdges_(0),
+                                                                            numSelfLoops_(0), numNegativeEdges_(0), numNonPositiveEdges_(0), maxDegree_(0) {}
 
   Property(const Property&) = default;                ///< @brief Copy constructor
   Property(Property&&) noexcept = default;            ///< @brief Move constructor
@@ -102,11 +108,78 @@ public:
    */
   inline void label(const std::string &label);
   //@}
+  /**
+   * @name Edge statistics
+   * @brief Statistics about the edges of the graph. Weights are stored as double, which is exact for all supported edge weight types.
+   */
+  //@{
+  /**
+   * @brief Registers a new edge.
+   * @param[in] weight Weight of the new edge.
+   * @param[in] isSelfLoop Whether the new edge starts and ends at the same node.
+   */
+  inline void edgeAdded(const double &weight, const bool &isSelfLoop);
+  /**
+   * @brief Unregisters a deleted edge.
+   * @param[in] weight Weight of the deleted edge.
+   * @param[in] isSelfLoop Whether the deleted edge starts and ends at the same node.
+   */
+  inline void edgeRemoved(const double &weight, const bool &isSelfLoop);
+  /**
+   * @brief Registers a change of an edge weight.
+   * @param[in] oldWeight Previous weight of the edge.
+   * @param[in] newWeight New weight of the edge.
+   * @param[in] isSelfLoop Whether the edge starts and ends at the same node.
+   */
+  inline void edgeWeightChanged(const double &oldWeight, const double &newWeight, const bool &isSelfLoop);
+  /**
+   * @brief Registers a change of the out-degree of a node.
+   * @param[in] oldDegree Previous out-degree of the node.
+   * @param[in] newDegree New out-degree of the node.
+   */
+  inline void degreeChanged(const idx_t &oldDegree, const idx_t &newDegree);
+  /**
+   * @brief Gets the number of self-loops in the graph.
+   * @return Number of self-loops.
+   */
+  inline idx_t numSelfLoops() const;
+  /**
+   * @brief Gets the number of edges with negative weight (self-loops included).
+   * @return Number of negative edges.
+   */
+  inline idx_t numNegativeEdges() const;
+  /**
+   * @brief Gets the number of edges with a weight of zero or less that are not self-loops.
+   * @return Number of non-positive edges that connect two different nodes.
+   */
+  inline idx_t numNonPositiveEdges() const;
+  /**
+   * @brief Gets the smallest edge weight in the graph.
+   * @return Minimum edge weight, 0 if there are no edges.
+   */
+  inline double minWeight() const;
+  /**
+   * @brief Gets the largest edge weight in the graph.
+   * @return Maximum edge weight, 0 if there are no edges.
+   */
+  inline double maxWeight() const;
+  /**
+   * @brief Gets the largest out-degree of any node in the graph.
+   * @return Maximum out-degree.
+   */
+  inline idx_t maxDegree() const;
+  //@}
 
 private:
   idx_t numNodes_;    ///< @brief Number of nodes in the graph
   idx_t numEdges_;    ///< @brief Number of edges in the graph
   std::string label_; ///< @brief Label of the graph
+  idx_t numSelfLoops_;                ///< @brief Number of self-loops
+  idx_t numNegativeEdges_;            ///< @brief Number of edges with negative weight
+  idx_t numNonPositiveEdges_;         ///< @brief Number of non-self-loop edges with non-positive weight
+  std::map<double, idx_t> weights_;   ///< @brief Number of edges per distinct weight
+  std::vector<idx_t> degreeCount_;    ///< @brief Number of nodes per (non-zero) out-degree
+  idx_t maxDegree_;                   ///< @brief Largest out-degree
 };
 
 ///////////////////////////////////////////////////////////
@@ -173,6 +246,65 @@ inline std::string Property::label() const {
 inline void Property::label(const std::string& label) {
   label_ = label;
 }
+
+// registers a new edge
+inline void Property::edgeAdded(const double& weight, const bool& isSelfLoop) {
+  ++weights_[weight];
+  if (isSelfLoop) ++numSelfLoops_;
+  if (weight < 0) ++numNegativeEdges_;
+  if (weight <= 0 && !isSelfLoop) ++numNonPositiveEdges_;
+}
+// unregisters a deleted edge
+inline void Property::edgeRemoved(const double& weight, const bool& isSelfLoop) {
+  auto it = weights_.find(weight);
+  GL_ASSERT(it != weights_.end(),"Property::edgeRemoved | No edge with this weight is registered")
+  if (--(it->second) == 0) weights_.erase(it);
+  if (isSelfLoop) --numSelfLoops_;
+  if (weight < 0) --numNegativeEdges_;
+  if (weight <= 0 && !isSelfLoop) --numNonPositiveEdges_;
+}
+// registers a weight change
+inline void Property::edgeWeightChanged(const double& oldWeight, const double& newWeight, const bool& isSelfLoop) {
+  if (oldWeight == newWeight) return;
+  edgeRemoved(oldWeight, isSelfLoop);
+  edgeAdded(newWeight, isSelfLoop);
+}
+// registers a degree change
+inline void Property::degreeChanged(const typename Property::idx_t& oldDegree, const typename Property::idx_t& newDegree) {
+  if (oldDegree > 0) --degreeCount_[oldDegree];
+  if (newDegree > 0) {
+    if (newDegree >= degreeCount_.size()) degreeCount_.resize(newDegree + 1, 0);
+    ++degreeCount_[newDegree];
+  }
+  if (newDegree > maxDegree_) maxDegree_ = newDegree;
+  // degrees change by small steps, so this loop runs amortized O(1) times
+  while (maxDegree_ > 0 && degreeCount_[maxDegree_] == 0) --maxDegree_;
+}
+
+// getter for numSelfLoops
+inline typename Property::idx_t Property::numSelfLoops() const {
+  return numSelfLoops_;
+}
+// getter for numNegativeEdges
+inline typename Property::idx_t Property::numNegativeEdges() const {
+  return numNegativeEdges_;
+}
+// getter for numNonPositiveEdges
+inline typename Property::idx_t Property::numNonPositiveEdges() const {
+  return numNonPositiveEdges_;
+}
+// getter for minWeight
+inline double Property::minWeight() const {
+  return weights_.empty() ? 0. : weights_.begin()->first;
+}
+// getter for maxWeight
+inline double Property::maxWeight() const {
+  return weights_.empty() ? 0. : weights_.rbegin()->first;
+}
+// getter for maxDegree
+inline typename Property::idx_t Property::maxDegree() const {
+  return maxDegree_;
+}
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 } // namespace gl
@@ -0,0 +1,106 @@
+#ifndef GL_RADIX_HEAP_HPP
+#define GL_RADIX_HEAP_HPP
+
+#include "../gl_base.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+/**
+ * An entry with key k is stored in bucket b = number of significant bits of (k XOR last), where last is the last popped key.
+ * Popping from an empty bucket 0 takes the first non-empty bucket, makes its minimum the new last key and redistributes
+ * its entries into lower buckets. Every entry moves down at most once per bit, so n operations cost O(n log C) independent
+ * of the range of keys. The queue is monotone: keys must not be smaller than the last popped key.
+ * Outdated entries are not removed (lazy deletion).
+ * @class RadixHeap
+ * @brief Monotone priority queue for non-negative integer keys.
+ * @tparam KEY Integral key type.
+ */
+template <class KEY>
+class RadixHeap
+{
+  static_assert(std::is_integral_v<KEY>, "RadixHeap | The key type has to be integral.");
+  using ukey_t = std::make_unsigned_t<KEY>;
+  static constexpr unsigned numBits = sizeof(ukey_t) * CHAR_BIT;
+
+public:
+  using key_t = KEY;                        ///< Key type
+  using idx_t = gl::index_type;             ///< Index type
+  using entry_t = std::pair<key_t, idx_t>;  ///< (key, node) pair
+
+  /**
+   * @brief Creates an empty queue.
+   */
+  RadixHeap() : buckets_(numBits + 1) {}
+
+  /**
+   * @brief Checks whether the queue is empty.
+   * @return true if no entry is queued.
+   */
+  bool empty() const { return size_ == 0; }
+  /**
+   * @brief Number of queued entries.
+   * @return Queue size.
+   */
+  idx_t size() const { return size_; }
+  /**
+   * @warning key must not be smaller than the last popped key.
+   * @brief Queues a node. O(log C).
+   * @param[in] key Key of the node
+   * @param[in] node Node ID
+   */
+  void push(const key_t key, const idx_t node)
+  {
+    buckets_[bucket(ukey_t(key))].emplace_back(ukey_t(key), node);
+    ++size_;
+  }
+  /**
+   * @warning The queue must not be empty.
+   * @brief Removes and returns an entry with the smallest key. Amortized O(log C).
+   * @return (key, node) pair
+   */
+  entry_t pop()
+  {
+    if (buckets_[0].empty()) {
+      unsigned i = 1;
+      while (buckets_[i].empty()) ++i;
+      auto& source = buckets_[i];
+      last_ = std::min_element(source.begin(), source.end())->first;
+      for (const auto& entry : source)
+        buckets_[bucket(entry.first)].push_back(entry);
+      source.clear();
+    }
+    auto entry = buckets_[0].back();
+    buckets_[0].pop_back();
+    --size_;
+    return {key_t(entry.first), entry.second};
+  }
+
+private:
+  /**
+   * @brief Bucket of a key relative to the last popped key.
+   */
+  unsigned bucket(const ukey_t key) const
+  {
+    ukey_t diff = key ^ last_;
+    unsigned bits = 0;
+    while (diff != 0) {
+      diff >>= 1;
+      ++bits;
+    }
+    return bits;
+  }
+
+  std::vector<std::vector<std::pair<ukey_t, idx_t>>> buckets_; ///< @brief Buckets by highest differing bit
+  ukey_t last_ = 0;                                            ///< @brief Last popped key
+  idx_t size_ = 0;                                             ///< @brief Number of queued entries
+};
+
+} // namespace gl
+
+#endif // GL_RADIX_HEAP_HPP
@@ -0,0 +1,228 @@
+#ifndef GL_SEARCH_WORKSPACE_HPP
+#define GL_SEARCH_WORKSPACE_HPP
+
+#include "../gl_base.hpp"
+#include "PathAlgebra.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+/**
+ * Holds the tentative distances, predecessors and the priority queue of a label-setting search (e.g. Dijkstra).
+ * The arrays are allocated once and reused between searches: reset() only clears the entries that the previous search touched,
+ * so a query that explores k nodes costs O(k log k) instead of O(V).
+ * @class SearchWorkspace
+ * @brief Reusable scratch memory for shortest path searches.
+ * @tparam SCALAR Number type used for distances.
+ * @tparam ALGEBRA Path algebra that decides which distances are improvements and how they are queued.
+ */
+template <class SCALAR, class ALGEBRA = MinPlus<SCALAR>>
+class SearchWorkspace
+{
+public:
+  using val_t = SCALAR;                       ///< Value type
+  using idx_t = gl::index_type;               ///< Index type
+  using entry_t = std::pair<val_t, idx_t>;    ///< Queue entry type (key, node), the key is ALGEBRA::priority(distance) unless given explicitly
+  using idx_list_t = std::vector<idx_t>;      ///< Index List type
+
+  /**
+   * @brief Default constructor. Creates a workspace for 0 nodes.
+   */
+  SearchWorkspace() = default;
+  /**
+   * @brief Creates a workspace for numNodes nodes.
+   * @param[in] numNodes Number of nodes of the graphs that will be searched.
+   */
+  explicit SearchWorkspace(const idx_t numNodes) { resize(numNodes); }
+
+  SearchWorkspace(const SearchWorkspace &) = default;                ///< @brief Copy constructor
+  SearchWorkspace(SearchWorkspace &&) noexcept = default;            ///< @brief Move constructor
+  SearchWorkspace &operator=(const SearchWorkspace &) = default;     ///< @brief Copy assignment
+  SearchWorkspace &operator=(SearchWorkspace &&) noexcept = default; ///< @brief Move assignment
+  ~SearchWorkspace() = default;                                      ///< @brief Destructor
+
+  /**
+   * @brief Resizes the workspace and clears all entries. O(numNodes).
+   * @param[in] numNodes Number of nodes of the graphs that will be searched.
+   */
+  void resize(const idx_t numNodes);
+  /**
+   * @brief Clears all entries touched since the last reset and empties the queue. O(touched).
+   */
+  void reset();
+  /**
+   * @brief Number of nodes the workspace has been sized for.
+   * @return Number of nodes.
+   */
+  idx_t size() const { return state_.size(); }
+
+  /**
+   * @brief Checks whether a node has a tentative distance.
+   * @param[in] node Node ID
+   * @return true if the node has been reached by the search.
+   */
+  bool isReached(const idx_t node) const { return state_[node] != UNREACHED; }
+  /**
+   * @brief Checks whether the distance of a node is final.
+   * @param[in] node Node ID
+   * @return true if the node has been settled.
+   */
+  bool isSettled(const idx_t node) const { return state_[node] == SETTLED; }
+  /**
+   * @brief Marks a node as settled.
+   * @param[in] node Node ID
+   */
+  void settle(const idx_t node) { state_[node] = SETTLED; }
+  /**
+   * @warning Only meaningful if isReached(node) is true.
+   * @brief Tentative (or final, if settled) distance of a node.
+   * @param[in] node Node ID
+   * @return Distance from the source(s).
+   */
+  val_t distance(const idx_t node) const { return distance_[node]; }
+  /**
+   * @warning Only meaningful if isReached(node) is true.
+   * @brief Predecessor of a node on its tentative shortest path.
+   * @param[in] node Node ID
+   * @return Predecessor ID, the node itself for sources.
+   */
+  idx_t predecessor(const idx_t node) const { return predecessor_[node]; }
+  /**
+   * Reaching a node for the first time records it for the next reset().
+   * @brief Updates the tentative distance of a node and queues it if the new distance is an improvement (ALGEBRA::better()).
+   * @param[in] node Node ID
+   * @param[in] distance Candidate distance
+   * @param[in] predecessor Predecessor on the candidate path
+   * @return true if the candidate improved the tentative distance.
+   */
+  bool relax(const idx_t node, const val_t distance, const idx_t predecessor);
+  /**
+   * Used by goal directed searches (e.g. A*) whose queue order differs from the distance order.
+   * @brief Same as relax(node, distance, predecessor), but queues the node with the given key instead of the priority of its distance.
+   * @param[in] node Node ID
+   * @param[in] distance Candidate distance
+   * @param[in] predecessor Predecessor on the candidate path
+   * @param[in] key Priority of the node in the queue
+   * @return true if the candidate improved the tentative distance.
+   */
+  bool relax(const idx_t node, const val_t distance, const idx_t predecessor, const val_t key);
+  /**
+   * @brief Nodes reached since the last reset.
+   * @return List of touched node IDs in order of first contact.
+   */
+  const idx_list_t &touched() const { return touched_; }
+
+  /**
+   * @brief Checks whether the priority queue is empty.
+   * @return true if no entries are queued.
+   */
+  bool empty() const { return queue_.empty(); }
+  /**
+   * @brief Removes and returns the queue entry with the smallest key. Entries may be outdated (lazy deletion).
+   * @return (key, node) pair
+   */
+  entry_t pop();
+  /**
+   * @brief Smallest queued key.
+   * @return Key of the queue top.
+   */
+  val_t top() const { return queue_.front().first; }
+  /**
+   * @brief Follows the predecessors from dest back to the source.
+   * @param[in] dest Reached node
+   * @return Node sequence from the source to dest.
+   */
+  idx_list_t path(const idx_t dest) const;
+
+private:
+  enum : unsigned char { UNREACHED = 0, REACHED = 1, SETTLED = 2 };
+
+  std::vector<val_t> distance_;       ///< @brief Tentative distances
+  std::vector<idx_t> predecessor_;    ///< @brief Tentative predecessors
+  std::vector<unsigned char> state_;  ///< @brief Search state per node
+  idx_list_t touched_;                ///< @brief Nodes to clear on reset
+  std::vector<entry_t> queue_;        ///< @brief Binary min-heap of (key, node)
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class SCALAR, class ALGEBRA>
+void SearchWorkspace<SCALAR, ALGEBRA>::resize(const idx_t numNodes)
+{
+  distance_.assign(numNodes, val_t(0));
+  predecessor_.assign(numNodes, idx_t(0));
+  state_.assign(numNodes, UNREACHED);
+  touched_.clear();
+  queue_.clear();
+}
+
+template <class SCALAR, class ALGEBRA>
+void SearchWorkspace<SCALAR, ALGEBRA>::reset()
+{
+  for (auto node : touched_)
+    state_[node] = UNREACHED;
+  touched_.clear();
+  queue_.clear();
+}
+
+template <class SCALAR, class ALGEBRA>
+bool SearchWorkspace<SCALAR, ALGEBRA>::relax(const idx_t node, const val_t distance, const idx_t predecessor)
+{
+  return relax(node, distance, predecessor, ALGEBRA::priority(distance));
+}
+
+template <class SCALAR, class ALGEBRA>
+bool SearchWorkspace<SCALAR, ALGEBRA>::relax(const idx_t node, const val_t distance, const idx_t predecessor, const val_t key)
+{
+  if (state_[node] == UNREACHED)
+  {
+    // the value of no path does not reach a node
+    if (!ALGEBRA::better(distance, ALGEBRA::zero()))
+      return false;
+    state_[node] = REACHED;
+    touched_.push_back(node);
+  }
+  else if (state_[node] == SETTLED || !ALGEBRA::better(distance, distance_[node]))
+  {
+    return false;
+  }
+  distance_[node] = distance;
+  predecessor_[node] = predecessor;
+  queue_.emplace_back(key, node);
+  std::push_heap(queue_.begin(), queue_.end(), std::greater<entry_t>());
+  return true;
+}
+
+template <class SCALAR, class ALGEBRA>
+typename SearchWorkspace<SCALAR, ALGEBRA>::entry_t SearchWorkspace<SCALAR, ALGEBRA>::pop()
+{
+  std::pop_heap(queue_.begin(), queue_.end(), std::greater<entry_t>());
+  entry_t out = queue_.back();
+  queue_.pop_back();
+  return out;
+}
+
+template <class SCALAR, class ALGEBRA>
+typename SearchWorkspace<SCALAR, ALGEBRA>::idx_list_t SearchWorkspace<SCALAR, ALGEBRA>::path(const idx_t dest) const
+{
+  idx_list_t out;
+  idx_t node = dest;
+  out.push_back(node);
+  while (predecessor_[node] != node)
+  {
+    node = predecessor_[node];
+    out.push_back(node);
+  }
+  std::reverse(out.begin(), out.end());
+  return out;
+}
+
+} // namespace gl
+
+#endif // GL_SEARCH_WORKSPACE_HPP
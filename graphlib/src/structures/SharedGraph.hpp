@@ -0,0 +1,175 @@
+#ifndef GL_SHARED_GRAPH_HPP
+#define GL_SHARED_GRAPH_HPP
+
+#include "../gl_base.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace gl {
+
+///////////////////////////////////////////////////////////
+//    SharedGraph Class declaration
+///////////////////////////////////////////////////////////
+
+/**
+ * A SharedGraph gives read-only access to a Graph that is either owned jointly by all handles (shared)
+ * or owned by somebody else (view). Copying a handle never copies the graph.
+ * The graph is only cloned if it is written to through mutate() while other handles still reference it (copy-on-write).
+ * @class SharedGraph
+ * @brief Cheap, immutable handle to a Graph with copy-on-write semantics.
+ * @tparam GRAPH Graph type that is referenced.
+ */
+template <class GRAPH>
+class SharedGraph
+{
+public:
+  using graph_t = GRAPH;                         ///< Graph type
+  using pointer_t = std::shared_ptr<const GRAPH>; ///< Shared pointer type
+
+  /**
+   * @brief Default constructor. Creates an empty handle that references no graph.
+   */
+  SharedGraph() : graph_(nullptr), isOwner_(false) {}
+  /**
+   * @brief Takes (shared) ownership of a graph.
+   * @param[in] graph Graph that will be moved into shared storage.
+   */
+  explicit SharedGraph(GRAPH &&graph) : graph_(std::make_shared<const GRAPH>(std::move(graph))), isOwner_(true) {}
+  /**
+   * @brief Shares ownership of a graph that is already managed by a shared pointer.
+   * @param[in] graph Pointer to the graph that will be shared.
+   */
+  explicit SharedGraph(const pointer_t &graph) : graph_(graph), isOwner_(true) {}
+
+  SharedGraph(const SharedGraph &) = default;                ///< @brief Copy constructor
+  SharedGraph(SharedGraph &&) noexcept = default;            ///< @brief Move constructor
+  SharedGraph &operator=(const SharedGraph &) = default;     ///< @brief Copy assignment
+  SharedGraph &operator=(SharedGraph &&) noexcept = default; ///< @brief Move assignment
+  ~SharedGraph() = default;                                  ///< @brief Destructor
+
+  /**
+   * @warning The referenced graph has to outlive the view and all of its copies.
+   * @brief Creates a non-owning view of a graph. O(1), the graph is not copied.
+   * @param[in] graph Graph that will be referenced.
+   * @return Non-owning handle to graph.
+   */
+  static SharedGraph view(const GRAPH &graph);
+  /**
+   * @brief Creates a handle that owns a copy of the given graph.
+   * @param[in] graph Graph that will be copied into shared storage.
+   * @return Owning handle to the copy.
+   */
+  static SharedGraph copy(const GRAPH &graph);
+
+  /**
+   * @brief Checks whether the handle references a graph.
+   * @return true if a graph is referenced, false otherwise.
+   */
+  explicit operator bool() const { return graph_ != nullptr; }
+  /**
+   * @brief Read access to the referenced graph.
+   * @return Const reference to the graph.
+   */
+  const GRAPH &operator*() const;
+  /**
+   * @brief Read access to the referenced graph.
+   * @return Const pointer to the graph.
+   */
+  const GRAPH *operator->() const;
+  /**
+   * @brief Read access to the referenced graph.
+   * @return Const pointer to the graph.
+   */
+  const GRAPH *get() const;
+  /**
+   * Detaches this handle before writing if the graph is shared with other handles or only viewed.
+   * All other handles keep seeing the unmodified graph.
+   * @brief Write access to the referenced graph (copy-on-write).
+   * @return Mutable reference to a graph that is exclusively owned by this handle.
+   */
+  GRAPH &mutate();
+  /**
+   * @brief Checks whether the handle shares ownership of the graph.
+   * @return true if the handle owns the graph, false if it is a view.
+   */
+  bool isOwner() const;
+  /**
+   * @brief Returns the number of owning handles referencing the graph (0 for views).
+   * @return Number of owning handles.
+   */
+  long useCount() const;
+
+private:
+  pointer_t graph_; ///< @brief Referenced graph
+  bool isOwner_;    ///< @brief Whether the handle takes part in the ownership of the graph
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class GRAPH>
+SharedGraph<GRAPH> SharedGraph<GRAPH>::view(const GRAPH &graph)
+{
+  SharedGraph out;
+  // aliasing constructor: points to graph without taking part in ownership
+  out.graph_ = pointer_t(pointer_t(), &graph);
+  out.isOwner_ = false;
+  return out;
+}
+
+template <class GRAPH>
+SharedGraph<GRAPH> SharedGraph<GRAPH>::copy(const GRAPH &graph)
+{
+  return SharedGraph(std::make_shared<const GRAPH>(graph));
+}
+
+template <class GRAPH>
+const GRAPH &SharedGraph<GRAPH>::operator*() const
+{
+  GL_ASSERT(graph_ != nullptr, "SharedGraph::operator* | Handle does not reference a graph.")
+  return *graph_;
+}
+
+template <class GRAPH>
+const GRAPH *SharedGraph<GRAPH>::operator->() const
+{
+  GL_ASSERT(graph_ != nullptr, "SharedGraph::operator-> | Handle does not reference a graph.")
+  return graph_.get();
+}
+
+template <class GRAPH>
+const GRAPH *SharedGraph<GRAPH>::get() const
+{
+  return graph_.get();
+}
+
+template <class GRAPH>
+GRAPH &SharedGraph<GRAPH>::mutate()
+{
+  GL_ASSERT(graph_ != nullptr, "SharedGraph::mutate | Handle does not reference a graph.")
+  if (!isOwner_ || graph_.use_count() != 1)
+  {
+    graph_ = std::make_shared<const GRAPH>(*graph_);
+    isOwner_ = true;
+  }
+  // the graph is exclusively owned by this handle, so writing cannot be observed elsewhere
+  return const_cast<GRAPH &>(*graph_);
+}
+
+template <class GRAPH>
+bool SharedGraph<GRAPH>::isOwner() const
+{
+  return isOwner_;
+}
+
+template <class GRAPH>
+long SharedGraph<GRAPH>::useCount() const
+{
+  return isOwner_ ? graph_.use_count() : 0;
+}
+
+} // namespace gl
+
+#endif // GL_SHARED_GRAPH_HPP
@@ -0,0 +1,186 @@
+#ifndef GL_SHORTEST_PATH_TREE_HPP
+#define GL_SHORTEST_PATH_TREE_HPP
+
+#include "../gl_base.hpp"
+#include "SharedGraph.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+/**
+ * The tree is stored as one parent per node, so it costs O(n) memory and hasEdge() is a single lookup.
+ * Children lists are only built when children() is first called. A Graph with the tree edges is only
+ * created by toGraph(), which reads weights and colors from the searched graph.
+ * The tree is a snapshot of a search result, it does not follow later modifications of the graph.
+ * @class ShortestPathTree
+ * @brief Lightweight view of a shortest path tree as a predecessor array.
+ * @tparam Graph Type of the searched graph.
+ */
+template <class Graph>
+class ShortestPathTree
+{
+public:
+  using idx_t = typename Graph::idx_t;           ///< Index type
+  using idx_list_t = typename Graph::idx_list_t; ///< Index List type
+
+  /**
+   * @brief Default constructor. Creates a tree without nodes.
+   */
+  ShortestPathTree() = default;
+  /**
+   * @brief Creates a tree from a predecessor array.
+   * @param[in] graph Handle to the searched graph
+   * @param[in] source Root of the tree
+   * @param[in] parents Parent of every node, the node itself for the source and for unreached nodes
+   */
+  ShortestPathTree(const SharedGraph<Graph> &graph, const idx_t source, std::vector<idx_t> parents)
+    : graph_(graph), source_(source), parent_(std::move(parents)) {}
+
+  ShortestPathTree(const ShortestPathTree &) = default;                ///< @brief Copy constructor
+  ShortestPathTree(ShortestPathTree &&) noexcept = default;            ///< @brief Move constructor
+  ShortestPathTree &operator=(const ShortestPathTree &) = default;     ///< @brief Copy assignment
+  ShortestPathTree &operator=(ShortestPathTree &&) noexcept = default; ///< @brief Move assignment
+  ~ShortestPathTree() = default;                                       ///< @brief Destructor
+
+  /**
+   * @brief Number of nodes of the searched graph.
+   * @return Number of nodes.
+   */
+  idx_t numNodes() const { return parent_.size(); }
+  /**
+   * @brief Number of tree edges, i.e. of reached nodes other than the source. O(n).
+   * @return Number of edges.
+   */
+  idx_t numEdges() const;
+  /**
+   * @brief Root of the tree.
+   * @return Source node of the search.
+   */
+  idx_t source() const { return source_; }
+  /**
+   * @brief Checks whether a node is part of the tree.
+   * @param[in] node Node ID
+   * @return true for the source and all nodes reachable from it.
+   */
+  bool isReached(const idx_t node) const;
+  /**
+   * @brief Predecessor of a node on its shortest path.
+   * @param[in] node Node ID
+   * @return Parent of node, the node itself for the source and unreached nodes.
+   */
+  idx_t parent(const idx_t node) const;
+  /**
+   * For trees of undirected graphs, the edge can be given in either direction. O(1).
+   * @brief Checks whether start->end is a tree edge.
+   * @param[in] start Edge origin
+   * @param[in] end Edge end
+   * @return true if the edge is part of the tree.
+   */
+  bool hasEdge(const idx_t start, const idx_t end) const;
+  /**
+   * The children lists of all nodes are built on the first call. O(n) once, then O(number of children).
+   * @brief Nodes whose parent is the given node.
+   * @param[in] node Node ID
+   * @return List of children in increasing order.
+   */
+  idx_list_t children(const idx_t node) const;
+  /**
+   * @brief Materializes the tree as a Graph with the weights and colors of the searched graph. O(n) edge insertions.
+   * @return Graph that only contains the tree edges.
+   */
+  Graph toGraph() const;
+
+private:
+  /**
+   * @brief Asserts that a node index is within the tree.
+   */
+  void checkRange(const idx_t node, const char *method) const;
+
+  SharedGraph<Graph> graph_;                 ///< @brief Searched graph
+  idx_t source_ = 0;                         ///< @brief Root of the tree
+  std::vector<idx_t> parent_;                ///< @brief Parent of every node, the node itself for the source and unreached nodes
+  mutable std::vector<idx_t> childOffsets_;  ///< @brief Children of u are childList_[childOffsets_[u] .. childOffsets_[u+1]), empty until needed
+  mutable std::vector<idx_t> childList_;     ///< @brief Children of all nodes, grouped by parent
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+template <class Graph>
+void ShortestPathTree<Graph>::checkRange(const idx_t node, const char *method) const
+{
+  GL_ASSERT(node < numNodes(), std::string("ShortestPathTree::") + method + std::string(" | Node index out of range."));
+}
+
+template <class Graph>
+typename ShortestPathTree<Graph>::idx_t ShortestPathTree<Graph>::numEdges() const
+{
+  idx_t edges = 0;
+  for (idx_t v = 0; v < numNodes(); ++v)
+    edges += (parent_[v] != v);
+  return edges;
+}
+
+template <class Graph>
+bool ShortestPathTree<Graph>::isReached(const idx_t node) const
+{
+  checkRange(node, "isReached");
+  return node == source_ || parent_[node] != node;
+}
+
+template <class Graph>
+typename ShortestPathTree<Graph>::idx_t ShortestPathTree<Graph>::parent(const idx_t node) const
+{
+  checkRange(node, "parent");
+  return parent_[node];
+}
+
+template <class Graph>
+bool ShortestPathTree<Graph>::hasEdge(const idx_t start, const idx_t end) const
+{
+  checkRange(start, "hasEdge");
+  checkRange(end, "hasEdge");
+  if (start == end) return false;
+  return parent_[end] == start || (graph_->isUndirected() && parent_[start] == end);
+}
+
+template <class Graph>
+typename ShortestPathTree<Graph>::idx_list_t ShortestPathTree<Graph>::children(const idx_t node) const
+{
+  checkRange(node, "children");
+  if (childOffsets_.empty()) {
+    // counting sort of the nodes by parent
+    const idx_t n = numNodes();
+    childOffsets_.assign(n + 1, 0);
+    for (idx_t v = 0; v < n; ++v)
+      if (parent_[v] != v) ++childOffsets_[parent_[v] + 1];
+    for (idx_t u = 0; u < n; ++u)
+      childOffsets_[u + 1] += childOffsets_[u];
+    childList_.resize(childOffsets_[n]);
+    std::vector<idx_t> next(childOffsets_.begin(), childOffsets_.end() - 1);
+    for (idx_t v = 0; v < n; ++v)
+      if (parent_[v] != v) childList_[next[parent_[v]]++] = v;
+  }
+  return idx_list_t(childList_.begin() + childOffsets_[node], childList_.begin() + childOffsets_[node + 1]);
+}
+
+template <class Graph>
+Graph ShortestPathTree<Graph>::toGraph() const
+{
+  GL_ASSERT(graph_, "ShortestPathTree::toGraph | The tree does not reference a graph.");
+  Graph result(numNodes(), std::string("SPT of node ") + std::to_string(source_) + std::string(" in ") + graph_->getGraphLabel());
+  for (idx_t v = 0; v < numNodes(); ++v) {
+    idx_t u = parent_[v];
+    if (u != v)
+      result.setEdge(u, v, graph_->getEdgeWeight(u, v), graph_->getEdgeColor(u, v));
+  }
+  return result;
+}
+
+} // namespace gl
+
+#endif // GL_SHORTEST_PATH_TREE_HPP
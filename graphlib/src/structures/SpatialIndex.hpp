@@ -0,0 +1,247 @@
+#ifndef GL_SPATIAL_INDEX_HPP
+#define GL_SPATIAL_INDEX_HPP
+
+#include "../gl_base.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+/**
+ * The bounding box of all points is divided into square cells, about one point per cell.
+ * Nearest-neighbour queries search rings of cells around the query until no closer point can exist,
+ * range queries only visit the cells overlapping the box. Both cost O(1 + k) for evenly spread points.
+ * Moving a point is O(1); the grid is only rebuilt when a point leaves its bounding box.
+ * @class SpatialIndex
+ * @brief Uniform grid over 2D points, e.g. node positions.
+ */
+class SpatialIndex {
+using idx_t = gl::index_type;
+public:
+  using point_t = std::pair<float,float>; ///< Point type (x,y), matching Node::position()
+  /**
+   * @brief Default constructor. Creates an empty index.
+   */
+  SpatialIndex() = default;
+  /**
+   * @brief Bulk constructor. Point i is stored with ID i.
+   * @param[in] points Positions of all points.
+   */
+  explicit SpatialIndex (const std::vector<point_t>& points);
+  // other constructors
+  SpatialIndex(const SpatialIndex &) = default;                ///< @brief Copy constructor
+  SpatialIndex(SpatialIndex &&) noexcept = default;            ///< @brief Move constructor
+  SpatialIndex &operator=(const SpatialIndex &) = default;     ///< @brief Copy assignment
+  SpatialIndex &operator=(SpatialIndex &&) noexcept = default; ///< @brief Move assignment
+  ~SpatialIndex() = default;                                   ///< @brief Destructor
+  /**
+   * @brief Replaces the content of the index. O(n).
+   * @param[in] points Positions of all points. Point i is stored with ID i.
+   */
+  void build (const std::vector<point_t>& points);
+  /**
+   * @brief Moves a point to a new position.
+   * @param[in] id ID of the point.
+   * @param[in] position New position of the point.
+   */
+  void update (idx_t id, const point_t& position);
+  /**
+   * @brief Finds the k points closest to a position (Euclidean distance).
+   * @param[in] position Query position.
+   * @param[in] k Number of points to find.
+   * @return IDs of the min(k,size()) closest points, ordered by distance and then by ID.
+   */
+  std::vector<idx_t> nearest (const point_t& position, idx_t k = 1) const;
+  /**
+   * @brief Finds all points inside an axis-aligned box (borders included).
+   * @param[in] lower Lower left corner of the box.
+   * @param[in] upper Upper right corner of the box.
+   * @return IDs of the points inside the box in ascending order.
+   */
+  std::vector<idx_t> range (const point_t& lower, const point_t& upper) const;
+  /**
+   * @brief Returns the number of indexed points.
+   * @return Number of points.
+   */
+  idx_t size () const;
+
+private:
+  /**
+   * @brief Distributes all points onto a new grid covering [lower,upper].
+   */
+  void rebuild (const point_t& lower, const point_t& upper);
+  /**
+   * @brief Cell column of an x-coordinate, clamped to the grid.
+   */
+  idx_t column (float x) const;
+  /**
+   * @brief Cell row of a y-coordinate, clamped to the grid.
+   */
+  idx_t row (float y) const;
+  /**
+   * @brief Squared distance between point id and a position.
+   */
+  double squaredDistance (idx_t id, const point_t& position) const;
+
+  std::vector<point_t> points_;          ///< Position of every point.
+  std::vector<std::vector<idx_t>> cells_; ///< Point IDs per cell, row-major.
+  std::vector<idx_t> cellOf_;            ///< Cell of every point.
+  std::vector<idx_t> slotOf_;            ///< Position of every point inside its cell.
+  point_t lower_ {0.f,0.f};              ///< Lower left corner of the grid.
+  point_t upper_ {0.f,0.f};              ///< Upper right corner of the grid.
+  double cellSize_ = 1.;                 ///< Side length of a cell.
+  idx_t columns_ = 0;                    ///< Number of cell columns.
+  idx_t rows_ = 0;                       ///< Number of cell rows.
+};
+
+///////////////////////////////////////////////////////////
+//    Member function implementations
+///////////////////////////////////////////////////////////
+
+inline SpatialIndex::SpatialIndex (const std::vector<point_t>& points) {
+  build(points);
+}
+
+inline void SpatialIndex::build (const std::vector<point_t>& points) {
+  points_ = points;
+  point_t lower {0.f,0.f}, upper {0.f,0.f};
+  if (!points_.empty()) {
+    lower = upper = points_.front();
+    for (const auto& p : points_) {
+      lower.first = std::min(lower.first,p.first);
+      lower.second = std::min(lower.second,p.second);
+      upper.first = std::max(upper.first,p.first);
+      upper.second = std::max(upper.second,p.second);
+    }
+  }
+  rebuild(lower,upper);
+}
+
+inline void SpatialIndex::rebuild (const point_t& lower, const point_t& upper) {
+  lower_ = lower;
+  upper_ = upper;
+  idx_t n = points_.size();
+  double extent = std::max(double(upper_.first)-lower_.first, double(upper_.second)-lower_.second);
+  // about one point per cell
+  cellSize_ = extent > 0 ? extent / std::ceil(std::sqrt(double(std::max(n,idx_t(1))))) : 1.;
+  columns_ = idx_t((double(upper_.first)-lower_.first) / cellSize_) + 1;
+  rows_ = idx_t((double(upper_.second)-lower_.second) / cellSize_) + 1;
+  cells_.assign(columns_*rows_,{});
+  cellOf_.resize(n);
+  slotOf_.resize(n);
+  for (idx_t id = 0; id < n; ++id) {
+    idx_t cell = row(points_[id].second)*columns_ + column(points_[id].first);
+    cellOf_[id] = cell;
+    slotOf_[id] = cells_[cell].size();
+    cells_[cell].push_back(id);
+  }
+}
+
+inline void SpatialIndex::update (idx_t id, const point_t& position) {
+  GL_ASSERT(id < points_.size(),std::string("SpatialIndex::update | Point ")+std::to_string(id)+std::string(" is not indexed"))
+  points_[id] = position;
+  if (position.first < lower_.first || position.first > upper_.first || position.second < lower_.second || position.second > upper_.second) {
+    // grow the grid generously so that further moves rarely trigger a rebuild
+    point_t lower {std::min(lower_.first,position.first), std::min(lower_.second,position.second)};
+    point_t upper {std::max(upper_.first,position.first), std::max(upper_.second,position.second)};
+    float marginX = (upper.first - lower.first) / 4, marginY = (upper.second - lower.second) / 4;
+    rebuild({lower.first-marginX, lower.second-marginY}, {upper.first+marginX, upper.second+marginY});
+    return;
+  }
+  idx_t cell = row(position.second)*columns_ + column(position.first);
+  if (cell == cellOf_[id]) return;
+  // swap-remove from the old cell
+  auto& old = cells_[cellOf_[id]];
+  old[slotOf_[id]] = old.back();
+  slotOf_[old.back()] = slotOf_[id];
+  old.pop_back();
+  cellOf_[id] = cell;
+  slotOf_[id] = cells_[cell].size();
+  cells_[cell].push_back(id);
+}
+
+inline std::vector<typename SpatialIndex::idx_t> SpatialIndex::nearest (const point_t& position, idx_t k) const {
+  std::vector<std::pair<double,idx_t>> found;
+  k = std::min(k,size());
+  if (k == 0) return {};
+  auto closer = [](const std::pair<double,idx_t>& lhs, const std::pair<double,idx_t>& rhs) { return lhs < rhs; };
+  long cx = column(position.first), cy = row(position.second);
+  long cols = columns_, rows = rows_;
+  for (long r = 0; ; ++r) {
+    // visit all cells at Chebyshev distance r from the query cell
+    for (long y = cy-r; y <= cy+r; ++y) {
+      if (y < 0 || y >= rows) continue;
+      bool border = (y == cy-r || y == cy+r);
+      for (long x = cx-r; x <= cx+r; x += (border ? 1 : 2*r)) {
+        if (x >= 0 && x < cols) {
+          for (auto id : cells_[y*cols+x]) {
+            found.emplace_back(squaredDistance(id,position),id);
+            std::push_heap(found.begin(),found.end(),closer);
+            if (found.size() > k) {
+              std::pop_heap(found.begin(),found.end(),closer);
+              found.pop_back();
+            }
+          }
+        }
+        if (r == 0) break;
+      }
+    }
+    // lower bound on the distance to any cell that has not been visited yet
+    double bound = -1;
+    auto consider = [&bound](double gap) { if (bound < 0 || gap < bound) bound = std::max(gap,0.); };
+    if (cx+r+1 < cols) consider(lower_.first + (cx+r+1)*cellSize_ - position.first);
+    if (cx-r-1 >= 0)   consider(position.first - (lower_.first + (cx-r)*cellSize_));
+    if (cy+r+1 < rows) consider(lower_.second + (cy+r+1)*cellSize_ - position.second);
+    if (cy-r-1 >= 0)   consider(position.second - (lower_.second + (cy-r)*cellSize_));
+    if (bound < 0) break; // all cells visited
+    if (found.size() == k && found.front().first <= bound*bound) break;
+  }
+  std::sort_heap(found.begin(),found.end(),closer);
+  std::vector<idx_t> out;
+  for (const auto& f : found)
+    out.push_back(f.second);
+  return out;
+}
+
+inline std::vector<typename SpatialIndex::idx_t> SpatialIndex::range (const point_t& lower, const point_t& upper) const {
+  std::vector<idx_t> out;
+  if (points_.empty() || lower.first > upper.first || lower.second > upper.second) return out;
+  for (idx_t y = row(lower.second); y <= row(upper.second); ++y) {
+    for (idx_t x = column(lower.first); x <= column(upper.first); ++x) {
+      for (auto id : cells_[y*columns_+x]) {
+        const auto& p = points_[id];
+        if (p.first >= lower.first && p.first <= upper.first && p.second >= lower.second && p.second <= upper.second)
+          out.push_back(id);
+      }
+    }
+  }
+  std::sort(out.begin(),out.end());
+  return out;
+}
+
+inline typename SpatialIndex::idx_t SpatialIndex::size () const {
+  return points_.size();
+}
+
+inline typename SpatialIndex::idx_t SpatialIndex::column (float x) const {
+  double c = std::floor((double(x) - lower_.first) / cellSize_);
+  return idx_t(std::min(std::max(c,0.),double(columns_-1)));
+}
+
+inline typename SpatialIndex::idx_t SpatialIndex::row (float y) const {
+  double c = std::floor((double(y) - lower_.second) / cellSize_);
+  return idx_t(std::min(std::max(c,0.),double(rows_-1)));
+}
+
+inline double SpatialIndex::squaredDistance (idx_t id, const point_t& position) const {
+  double dx = double(points_[id].first) - position.first;
+  double dy = double(points_[id].second) - position.second;
+  return dx*dx + dy*dy;
+}
+
+} // namespace gl
+
+#endif // GL_SPATIAL_INDEX_HPP
@@ -0,0 +1,81 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+#include <random>
+
+template <class Graph, class Heuristic>
+void compareWithDijkstra (Graph& g, const Heuristic& heuristic)
+{
+  gl::algorithm::Dijkstra<Graph> reference(g);
+  gl::algorithm::AStar<Graph,Heuristic> search(g,heuristic);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src) {
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+      auto expected = reference.pathLength(src,dest);
+      if (!expected.isInfinite())
+        GL_ASSERT(heuristic(g,src,dest) <= expected.scalarDistance(),"Landmark heuristic overestimates a distance")
+      GL_ASSERT(search.pathLength(src,dest) == expected,"ALT differs from Dijkstra")
+      auto path = search.getPath(src,dest);
+      GL_ASSERT(path.first == !expected.isInfinite(),"getPath reports the wrong reachability")
+      if (!path.first) continue;
+      typename Graph::val_t sum = 0;
+      for (gl::index_type i = 1; i < path.second.size(); ++i)
+        sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+      GL_ASSERT_EQUAL(sum,expected.scalarDistance())
+    }
+  }
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestSelection (const std::string& type)
+{
+  GL_TEST_BEGIN("Landmark selection " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  for (auto selection : {gl::algorithm::LandmarkSelection::Farthest, gl::algorithm::LandmarkSelection::Avoid}) {
+    gl::algorithm::LandmarkHeuristic<decltype(g)> heuristic(g,3,selection,2);
+    GL_ASSERT_EQUAL(heuristic.numLandmarks(),3)
+    auto landmarks = heuristic.landmarks();
+    std::sort(landmarks.begin(),landmarks.end());
+    GL_ASSERT(std::unique(landmarks.begin(),landmarks.end()) == landmarks.end(),"Landmarks are not distinct")
+    GL_ASSERT_EQUAL(heuristic.memoryUsage(),(g.isDirected() ? 2 : 1) * 3 * g.numNodes() * sizeof(SCALAR))
+    compareWithDijkstra(g,heuristic);
+  }
+  GL_TEST_CATCH_ERROR(gl::algorithm::LandmarkHeuristic<decltype(g)> tooMany(g,11);,std::runtime_error,
+                      "LandmarkHeuristic::select | More landmarks requested than the graph has nodes.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestRandom (const std::string& type)
+{
+  GL_TEST_BEGIN("ALT random " << type)
+  using Graph = gl::Graph<SCALAR,STORAGE,DIRECTION>;
+  Graph g(60,type);
+  std::mt19937 gen(35);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  std::uniform_int_distribution<int> weight(1,20);
+  for (int i = 0; i < 180; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(weight(gen)));
+  }
+  gl::algorithm::LandmarkHeuristic<Graph> heuristic(g,4,gl::algorithm::LandmarkSelection::Avoid,4);
+  compareWithDijkstra(g,heuristic);
+  // the tables do not depend on the number of threads
+  gl::algorithm::LandmarkHeuristic<Graph> sequential(g,4,gl::algorithm::LandmarkSelection::Avoid,1);
+  GL_ASSERT(heuristic.landmarks() == sequential.landmarks(),"Landmarks depend on the number of threads")
+  for (gl::index_type u = 0; u < g.numNodes(); ++u)
+    GL_ASSERT_EQUAL(heuristic(g,u,0),sequential(g,u,0))
+  // explicit landmarks through the ALT alias
+  gl::algorithm::ALT<Graph> alt(g,gl::algorithm::LandmarkHeuristic<Graph>(g,typename Graph::idx_list_t{0,17,42}));
+  gl::algorithm::Dijkstra<Graph> reference(g);
+  for (gl::index_type dest = 0; dest < g.numNodes(); ++dest)
+    GL_ASSERT(alt.pathLength(5,dest) == reference.pathLength(5,dest),"ALT differs from Dijkstra")
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestSelection)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestRandom)
+  return 0;
+}
@@ -0,0 +1,93 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+template <class Graph, class Search>
+void compareWithDijkstra (Graph& g, Search& search)
+{
+  gl::algorithm::Dijkstra<Graph> reference(g);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src) {
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+      auto expected = reference.pathLength(src,dest);
+      auto length = search.pathLength(src,dest);
+      GL_ASSERT(length == expected,"A* differs from Dijkstra")
+      auto path = search.getPath(src,dest);
+      GL_ASSERT(path.first == !expected.isInfinite(),"getPath reports the wrong reachability")
+      if (!path.first) continue;
+      GL_ASSERT(path.second.front() == src && path.second.back() == dest,"getPath has the wrong endpoints")
+      typename Graph::val_t sum = 0;
+      for (gl::index_type i = 1; i < path.second.size(); ++i)
+        sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+      GL_ASSERT_EQUAL(sum,expected.scalarDistance())
+    }
+  }
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestEuclidean (const std::string& type)
+{
+  GL_TEST_BEGIN("A* Euclidean " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  for (gl::index_type i = 0; i < g.numNodes(); ++i)
+    g.updateNode(i,std::make_pair(float(i % 3),float(i / 3)));
+  double scale = gl::algorithm::EuclideanHeuristic::admissibleScale(g);
+  GL_ASSERT(scale > 0,"admissibleScale has to be positive")
+  gl::algorithm::AStar<decltype(g)> search(g,gl::algorithm::EuclideanHeuristic(scale));
+  compareWithDijkstra(g,search);
+  search.pathLength(0,0);
+  GL_ASSERT_EQUAL(search.numSettled(),1)
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestHaversine (const std::string& type)
+{
+  GL_TEST_BEGIN("A* Haversine " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  for (gl::index_type i = 0; i < g.numNodes(); ++i)
+    g.updateNode(i,std::make_pair(7.f + 0.1f * (i % 3),46.f + 0.1f * (i / 3)));
+  GL_ASSERT(std::abs(gl::algorithm::HaversineHeuristic::distance({0.f,0.f},{0.f,90.f},1.) - std::acos(-1.)/2) < 1e-6,
+            "Wrong great-circle distance")
+  double scale = gl::algorithm::HaversineHeuristic::admissibleScale(g);
+  gl::algorithm::AStar<decltype(g),gl::algorithm::HaversineHeuristic> search(g,gl::algorithm::HaversineHeuristic(scale));
+  compareWithDijkstra(g,search);
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestCustomHeuristic (const std::string& type)
+{
+  GL_TEST_BEGIN("A* custom heuristic " << type)
+  using Graph = gl::Graph<SCALAR,STORAGE,DIRECTION>;
+  Graph g(10,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  // exact distances are the best possible consistent heuristic: mostly nodes on shortest paths are settled
+  auto exact = [](const Graph& graph, gl::index_type node, gl::index_type target) {
+    gl::algorithm::Dijkstra<Graph> dijkstra(graph);
+    auto d = dijkstra.pathLength(target,node);
+    return d.isInfinite() ? 0. : double(d.scalarDistance());
+  };
+  if (!g.isDirected()) {
+    gl::algorithm::AStar<Graph,decltype(exact)> search(g,exact);
+    compareWithDijkstra(g,search);
+    search.pathLength(0,4);
+    GL_ASSERT(search.numSettled() < g.numNodes() - 1,"A* with exact estimates settles too many nodes")
+  }
+  gl::algorithm::AStar<Graph,gl::algorithm::ZeroHeuristic> zero(g);
+  compareWithDijkstra(g,zero);
+  // modifications of the graph are picked up
+  g.setEdge(0,4,SCALAR(1));
+  GL_ASSERT_EQUAL(zero.pathLength(0,4).scalarDistance(),SCALAR(1))
+  g.updateEdge(0,1,SCALAR(-1));
+  GL_TEST_CATCH_ERROR(zero.pathLength(0,4);,std::runtime_error,"AStar::search | Found non-positive edge weights in the graph.")
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestEuclidean)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestHaversine)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestCustomHeuristic)
+  return 0;
+}
@@ -0,0 +1,156 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+#include <random>
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestSmallGraph (const std::string& type)
+{
+  GL_TEST_BEGIN("Bellman-Ford " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::Dijkstra<decltype(g)> reference(g);
+  for (auto mode : {gl::algorithm::BellmanFordMode::SPFA, gl::algorithm::BellmanFordMode::Rounds}) {
+    for (unsigned numThreads : {1u, 4u}) {
+      gl::algorithm::BellmanFord<decltype(g)> bellman_ford(g,mode,numThreads);
+      for (gl::index_type src = 0; src < g.numNodes(); ++src) {
+        GL_ASSERT(!bellman_ford.hasNegativeCycle(src),"There is no negative cycle")
+        for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+          auto expected = reference.pathLength(src,dest);
+          GL_ASSERT(bellman_ford.pathLength(src,dest) == expected,"Bellman-Ford differs from Dijkstra")
+          auto path = bellman_ford.getPath(src,dest);
+          GL_ASSERT(path.first == !expected.isInfinite(),"getPath reports the wrong reachability")
+          if (!path.first) continue;
+          GL_ASSERT(path.second.front() == src && path.second.back() == dest,"getPath has the wrong endpoints")
+          SCALAR sum = 0;
+          for (gl::index_type i = 1; i < path.second.size(); ++i)
+            sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+          GL_ASSERT_EQUAL(sum,expected.scalarDistance())
+        }
+      }
+    }
+  }
+  gl::algorithm::BellmanFord<decltype(g)> bellman_ford(g);
+  std::vector<gl::Distance<SCALAR>> distances;
+  std::vector<gl::index_type> predecessors;
+  bellman_ford.queryDistances(2,distances,predecessors);
+  GL_ASSERT_EQUAL(predecessors[2],2)
+  GL_ASSERT_EQUAL(predecessors[9],9)
+  GL_ASSERT(distances[9].isInfinite(),"Node 9 is unreachable")
+  GL_ASSERT(!bellman_ford.getShortestPathTree(0).isReached(9),"Node 9 is not connected to 0")
+  GL_ASSERT_EQUAL_GRAPH(bellman_ford.getSPT(0),reference.getSPT(0))
+  GL_ASSERT(bellman_ford.getNegativeCycle(0).empty(),"There is no negative cycle")
+
+  // modifications of the graph are picked up
+  g.updateEdge(0,1,SCALAR(1));
+  GL_ASSERT_EQUAL(bellman_ford.pathLength(0,1).scalarDistance(),SCALAR(1))
+
+  gl::algorithm::BellmanFord<decltype(g)> empty;
+  GL_TEST_CATCH_ERROR(empty.pathLength(0,3);,std::runtime_error,"BellmanFord::pathLength | BellmanFord has not been initialized with a graph.")
+  GL_TEST_CATCH_ERROR(empty.hasNegativeCycle(0);,std::runtime_error,"BellmanFord::hasNegativeCycle | BellmanFord has not been initialized with a graph.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestNegativeWeights (const std::string& type)
+{
+  GL_TEST_BEGIN("Bellman-Ford negative weights " << type)
+  // w(u,v) = c(u,v) + p(u) - p(v) with c > 0: negative edges, but every cycle is positive
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(400,type);
+  std::mt19937 gen(49);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  std::uniform_int_distribution<int> cost(1,10), shift(0,30);
+  std::vector<int> p(g.numNodes());
+  for (auto& x : p)
+    x = shift(gen);
+  for (int i = 0; i < 3000; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(cost(gen) + p[u] - p[v]));
+  }
+  GL_ASSERT(g.numNegativeEdges() > 0,"The graph has negative edges")
+  GL_TEST_CATCH_ERROR(gl::algorithm::Dijkstra<decltype(g)>(g).pathLength(0,1);,std::runtime_error,"Dijkstra::compute | Found non-positive edge weights in the graph.")
+
+  gl::algorithm::FloydWarshall<decltype(g)> reference(g);
+  gl::algorithm::BellmanFord<decltype(g)> spfa(g);
+  // large frontiers, relaxed by several threads
+  gl::algorithm::BellmanFord<decltype(g)> rounds(g,gl::algorithm::BellmanFordMode::Rounds,4);
+  std::vector<gl::Distance<SCALAR>> distances;
+  std::vector<gl::index_type> predecessors;
+  for (gl::index_type src : {0, 123, 399}) {
+    for (auto* algorithm : {&spfa, &rounds}) {
+      algorithm->queryDistances(src,distances,predecessors);
+      for (gl::index_type v = 0; v < g.numNodes(); ++v) {
+        GL_ASSERT(distances[v] == reference.pathLength(src,v),"Bellman-Ford differs from Floyd-Warshall")
+        if (v != src && !distances[v].isInfinite())
+          GL_ASSERT(distances[predecessors[v]] + gl::Distance<SCALAR>(g.getEdgeWeight(predecessors[v],v)) == distances[v],"Predecessor edge is not tight")
+      }
+    }
+  }
+
+  std::vector<SCALAR> potential;
+  GL_ASSERT(!spfa.computePotential(potential).first,"There is no negative cycle")
+  for (gl::index_type u = 0; u < g.numNodes(); ++u) {
+    GL_ASSERT(!(potential[u] > SCALAR(0)),"The potential is a distance from the virtual source")
+    for (auto edge : g.getNeighbourWeights(u))
+      GL_ASSERT(!(edge.second + potential[u] - potential[edge.first] < SCALAR(0)),"Reduced weights are non-negative")
+  }
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestNegativeCycle (const std::string& type)
+{
+  GL_TEST_BEGIN("Bellman-Ford negative cycle " << type)
+  // negative cycle 1 -> 2 -> 3 -> 1, reachable from 0 but not from 4
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(6,type);
+  g.setEdge(0,1,SCALAR(4));
+  g.setEdge(1,2,SCALAR(-2));
+  g.setEdge(2,3,SCALAR(-1));
+  g.setEdge(3,1,SCALAR(2));
+  g.setEdge(3,4,SCALAR(1));
+  g.setEdge(4,5,SCALAR(-3));
+  for (auto mode : {gl::algorithm::BellmanFordMode::SPFA, gl::algorithm::BellmanFordMode::Rounds}) {
+    gl::algorithm::BellmanFord<decltype(g)> bellman_ford(g,mode,2);
+    GL_ASSERT(bellman_ford.hasNegativeCycle(0),"The negative cycle is reachable from 0")
+    auto cycle = bellman_ford.getNegativeCycle(0);
+    GL_ASSERT_EQUAL(cycle.size(),4)
+    GL_ASSERT_EQUAL(cycle.front(),cycle.back())
+    SCALAR sum = 0;
+    for (gl::index_type i = 1; i < cycle.size(); ++i) {
+      GL_ASSERT(g.hasEdge(cycle[i-1],cycle[i]),"The cycle uses a non-existing edge")
+      sum += g.getEdgeWeight(cycle[i-1],cycle[i]);
+    }
+    GL_ASSERT_EQUAL(sum,SCALAR(-1))
+    std::string node = std::to_string(cycle.front());
+    GL_TEST_CATCH_ERROR(bellman_ford.pathLength(0,5);,std::runtime_error,"BellmanFord::pathLength | The input graph has a negative cycle at node "+node)
+    GL_TEST_CATCH_ERROR(bellman_ford.getPath(0,5);,std::runtime_error,"BellmanFord::getPath | The input graph has a negative cycle at node "+node)
+
+    GL_ASSERT(!bellman_ford.hasNegativeCycle(4),"The negative cycle is not reachable from 4")
+    GL_ASSERT_EQUAL(bellman_ford.pathLength(4,5).scalarDistance(),SCALAR(-3))
+    std::vector<SCALAR> potential;
+    GL_ASSERT(bellman_ford.computePotential(potential).first,"The virtual source reaches every cycle")
+
+    // breaking the cycle is picked up
+    g.updateEdge(3,1,SCALAR(4));
+    GL_ASSERT(!bellman_ford.hasNegativeCycle(0),"The cycle has weight 1 now")
+    GL_ASSERT_EQUAL(bellman_ford.pathLength(0,5).scalarDistance(),SCALAR(-1))
+    g.updateEdge(3,1,SCALAR(2));
+  }
+
+  gl::Graph<SCALAR,STORAGE,gl::Undirected> g2(3,type);
+  g2.setEdge(0,1,SCALAR(-2));
+  gl::algorithm::BellmanFord<decltype(g2)> undirected(g2);
+  GL_TEST_CATCH_ERROR(undirected.pathLength(0,1);,std::runtime_error,"BellmanFord::synchronize | Graph is undirected and contains negative weights.")
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestSmallGraph)
+  GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestNegativeWeights,int)
+  GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestNegativeWeights,double)
+  GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestNegativeCycle,int)
+  GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestNegativeCycle,float)
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestAdjacencyArray (const std::string& type)
+{
+  GL_TEST_BEGIN("Adjacency array " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(4,type);
+  g.setEdge(0,1,SCALAR(2));
+  g.setEdge(0,2,SCALAR(3));
+  g.setEdge(2,3,SCALAR(4));
+  g.setEdge(3,3,SCALAR(1)); // self-loops are skipped
+  gl::AdjacencyArray<SCALAR> forward(g);
+  gl::AdjacencyArray<SCALAR> backward(g,true);
+  GL_ASSERT_EQUAL(forward.numNodes(),4)
+  GL_ASSERT_EQUAL(forward.numEdges(),g.isDirected() ? 3 : 6)
+  GL_ASSERT_EQUAL(forward.degree(0),2)
+  GL_ASSERT_EQUAL(backward.degree(0),g.isDirected() ? 0 : 2)
+  GL_ASSERT_EQUAL(backward.degree(3),1)
+  GL_ASSERT_EQUAL(backward.target(backward.begin(3)),2)
+  GL_ASSERT_EQUAL(backward.weight(backward.begin(3)),SCALAR(4))
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestBidirectionalDijkstra (const std::string& type)
+{
+  GL_TEST_BEGIN("Bidirectional Dijkstra " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::Dijkstra<decltype(g)> reference(g);
+  gl::algorithm::BidirectionalDijkstra<decltype(g)> bidirectional(g);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src) {
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+      auto expected = reference.pathLength(src,dest);
+      auto length = bidirectional.pathLength(src,dest);
+      GL_ASSERT(length == expected,"Bidirectional Dijkstra differs from Dijkstra")
+      auto path = bidirectional.getPath(src,dest);
+      GL_ASSERT(path.first == !expected.isInfinite(),"getPath reports the wrong reachability")
+      if (!path.first) continue;
+      GL_ASSERT(path.second.front() == src && path.second.back() == dest,"getPath has the wrong endpoints")
+      SCALAR sum = 0;
+      for (gl::index_type i = 1; i < path.second.size(); ++i)
+        sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+      GL_ASSERT_EQUAL(sum,expected.scalarDistance())
+    }
+  }
+  // modifications of the graph are picked up
+  g.setEdge(0,4,SCALAR(1));
+  GL_ASSERT_EQUAL(bidirectional.pathLength(0,4).scalarDistance(),SCALAR(1))
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestBidirectionalBFS (const std::string& type)
+{
+  GL_TEST_BEGIN("Bidirectional BFS " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::BidirectionalBFS<decltype(g)> bidirectional(g);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src) {
+    gl::algorithm::BFS<decltype(g)> reference(g,src);
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+      auto expected = reference.getNodeDistance(dest);
+      GL_ASSERT_EQUAL(bidirectional.pathLength(src,dest),expected)
+      auto path = bidirectional.getPath(src,dest);
+      GL_ASSERT(path.first == (expected != GL_INF(gl::index_type)),"getPath reports the wrong reachability")
+      if (!path.first) continue;
+      GL_ASSERT_EQUAL(path.second.size(),expected+1)
+      GL_ASSERT(path.second.front() == src && path.second.back() == dest,"getPath has the wrong endpoints")
+      for (gl::index_type i = 1; i < path.second.size(); ++i)
+        GL_ASSERT(g.hasEdge(path.second[i-1],path.second[i]),"getPath uses a non-existing edge")
+    }
+  }
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestAdjacencyArray)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestBidirectionalDijkstra)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestBidirectionalBFS)
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+#include <random>
+
+template <class Graph>
+void compareWithDijkstra (const Graph& g, gl::algorithm::ContractionHierarchies<Graph>& ch)
+{
+  gl::algorithm::Dijkstra<Graph> reference(g);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src) {
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+      auto expected = reference.pathLength(src,dest);
+      auto length = ch.pathLength(src,dest);
+      GL_ASSERT(length == expected,"Contraction Hierarchies differ from Dijkstra")
+      auto path = ch.getPath(src,dest);
+      GL_ASSERT(path.first == !expected.isInfinite(),"getPath reports the wrong reachability")
+      if (!path.first) continue;
+      GL_ASSERT(path.second.front() == src && path.second.back() == dest,"getPath has the wrong endpoints")
+      typename Graph::val_t sum = 0;
+      for (gl::index_type i = 1; i < path.second.size(); ++i) {
+        GL_ASSERT(g.hasEdge(path.second[i-1],path.second[i]),"getPath uses a non-existing edge")
+        sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+      }
+      GL_ASSERT_EQUAL(sum,expected.scalarDistance())
+    }
+  }
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestSmall (const std::string& type)
+{
+  GL_TEST_BEGIN("Contraction Hierarchies small " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::ContractionHierarchies<decltype(g)> ch(g);
+  GL_ASSERT_EQUAL(ch.numNodes(),10)
+  compareWithDijkstra(g,ch);
+  g.updateEdge(0,1,SCALAR(-1));
+  GL_TEST_CATCH_ERROR(gl::algorithm::ContractionHierarchies<decltype(g)> bad(g);,std::runtime_error,
+                      "ContractionHierarchies::build | Found non-positive edge weights in the graph.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestRandom (const std::string& type)
+{
+  GL_TEST_BEGIN("Contraction Hierarchies random " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(80,type);
+  std::mt19937 gen(34);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  std::uniform_int_distribution<int> weight(1,20);
+  for (int i = 0; i < 240; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(weight(gen)));
+  }
+  gl::algorithm::ContractionHierarchies<decltype(g)> ch(g,4);
+  compareWithDijkstra(g,ch);
+  // the contraction order does not depend on the number of threads
+  gl::algorithm::ContractionHierarchies<decltype(g)> sequential(g,1);
+  for (gl::index_type i = 0; i < g.numNodes(); ++i)
+    GL_ASSERT_EQUAL(ch.rank(i),sequential.rank(i))
+  GL_ASSERT_EQUAL(ch.numShortcuts(),sequential.numShortcuts())
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestSerialization (const std::string& type)
+{
+  GL_TEST_BEGIN("Contraction Hierarchies serialization " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::ContractionHierarchies<decltype(g)> ch(g);
+  const std::string filename = "Test_ContractionHierarchies_" + type + ".ch";
+  ch.save(filename);
+  gl::algorithm::ContractionHierarchies<decltype(g)> loaded;
+  loaded.load(filename);
+  GL_ASSERT_EQUAL(loaded.numNodes(),ch.numNodes())
+  GL_ASSERT_EQUAL(loaded.numShortcuts(),ch.numShortcuts())
+  compareWithDijkstra(g,loaded);
+  std::remove(filename.c_str());
+  GL_TEST_CATCH_ERROR(loaded.load("../../test/input/dijkstra9");,std::runtime_error,
+                      "ContractionHierarchies::load | Not a contraction hierarchy file: ../../test/input/dijkstra9")
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestSmall)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestRandom)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestSerialization)
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+#include <random>
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestSmallGraph (const std::string& type)
+{
+  GL_TEST_BEGIN("Delta-stepping " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::Dijkstra<decltype(g)> reference(g);
+  // automatic delta, every edge light, every edge heavy
+  for (SCALAR delta : {SCALAR(0), SCALAR(100), SCALAR(1)}) {
+    for (unsigned numThreads : {1u, 4u}) {
+      gl::algorithm::DeltaStepping<decltype(g)> delta_stepping(g,numThreads,delta);
+      for (gl::index_type src = 0; src < g.numNodes(); ++src) {
+        for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+          auto expected = reference.pathLength(src,dest);
+          GL_ASSERT(delta_stepping.pathLength(src,dest) == expected,"Delta-stepping differs from Dijkstra")
+          auto path = delta_stepping.getPath(src,dest);
+          GL_ASSERT(path.first == !expected.isInfinite(),"getPath reports the wrong reachability")
+          if (!path.first) continue;
+          GL_ASSERT(path.second.front() == src && path.second.back() == dest,"getPath has the wrong endpoints")
+          SCALAR sum = 0;
+          for (gl::index_type i = 1; i < path.second.size(); ++i)
+            sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+          GL_ASSERT_EQUAL(sum,expected.scalarDistance())
+        }
+      }
+    }
+  }
+  gl::algorithm::DeltaStepping<decltype(g)> delta_stepping(g);
+  std::vector<gl::Distance<SCALAR>> distances;
+  std::vector<gl::index_type> predecessors;
+  delta_stepping.queryDistances(2,distances,predecessors);
+  GL_ASSERT_EQUAL(predecessors[2],2)
+  GL_ASSERT_EQUAL(predecessors[9],9)
+  GL_ASSERT(distances[9].isInfinite(),"Node 9 is unreachable")
+
+  // modifications of the graph are picked up
+  g.updateEdge(0,1,SCALAR(1));
+  GL_ASSERT_EQUAL(delta_stepping.pathLength(0,1).scalarDistance(),SCALAR(1))
+  g.updateEdge(0,1,SCALAR(-1));
+  GL_TEST_CATCH_ERROR(delta_stepping.pathLength(0,1);,std::runtime_error,"DeltaStepping::synchronize | Found non-positive edge weights in the graph.")
+  GL_TEST_CATCH_ERROR(gl::algorithm::DeltaStepping<decltype(g)>(g,1,SCALAR(-1));,std::runtime_error,"DeltaStepping::DeltaStepping | The bucket width must not be negative.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestRandomGraph (const std::string& type)
+{
+  GL_TEST_BEGIN("Delta-stepping on a random graph " << type)
+  // large enough for frontiers that are relaxed by several threads
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(5000,type);
+  std::mt19937 gen(39);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  std::uniform_int_distribution<int> weight(1,20);
+  for (int i = 0; i < 40000; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v)) g.setEdge(u,v,SCALAR(weight(gen)));
+  }
+  gl::algorithm::Dijkstra<decltype(g)> reference(g);
+  gl::algorithm::DeltaStepping<decltype(g)> parallel(g,4);
+  gl::algorithm::DeltaStepping<decltype(g)> narrow(g,4,SCALAR(1));
+  std::vector<gl::Distance<SCALAR>> expected, distances;
+  std::vector<gl::index_type> predecessors;
+  for (gl::index_type src : {0, 1234, 4999}) {
+    reference.queryDistances(src,expected);
+    for (auto* algorithm : {&parallel, &narrow}) {
+      algorithm->queryDistances(src,distances,predecessors);
+      for (gl::index_type v = 0; v < g.numNodes(); ++v) {
+        GL_ASSERT(distances[v] == expected[v],"Delta-stepping differs from Dijkstra")
+        if (v != src && !distances[v].isInfinite())
+          GL_ASSERT(distances[predecessors[v]] + gl::Distance<SCALAR>(g.getEdgeWeight(predecessors[v],v)) == distances[v],"Predecessor edge is not tight")
+      }
+    }
+  }
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestSmallGraph)
+  GL_TEST_FUNCTION_WITH_LIST_TYPES(TestRandomGraph,int)
+  GL_TEST_FUNCTION_WITH_LIST_TYPES(TestRandomGraph,double)
+  return 0;
+}
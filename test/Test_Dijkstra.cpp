@@ -1,6 +1,7 @@
 #include <graphlib/gl>
 #include "gl_test.hpp"
 
+#include <random>
 #include <vector>
 #include <utility> // for std::pair
 
@@ -161,6 +162,38 @@ void TestGetSPTDirected (const std::string& type)
   GL_TEST_END()
 }
 
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestShortestPathTree (const std::string& type)
+{
+  GL_TEST_BEGIN("Shortest path tree view " << type)
+  gl::Graph<int,STORAGE,DIRECTION> g(10,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::Dijkstra<decltype(g)> d(g);
+  auto tree = d.getShortestPathTree(0);
+  auto spt = d.getSPT(0);
+  GL_ASSERT_EQUAL(tree.numNodes(),10)
+  GL_ASSERT_EQUAL(tree.numEdges(),8)
+  GL_ASSERT_EQUAL(tree.source(),0)
+  GL_ASSERT(tree.isReached(0),"The source is part of the tree")
+  GL_ASSERT(!tree.isReached(9),"Node 9 is not connected to 0")
+  GL_ASSERT_EQUAL(tree.parent(9),9)
+  GL_ASSERT_EQUAL(tree.children(9).size(),0)
+  for (gl::index_type u = 0; u < 10; ++u)
+  {
+    for (gl::index_type v = 0; v < 10; ++v)
+      GL_ASSERT_EQUAL_DESC(tree.hasEdge(u,v),spt.hasEdge(u,v),"Edge "+std::to_string(u)+"->"+std::to_string(v))
+    for (auto c : tree.children(u))
+      GL_ASSERT_EQUAL(tree.parent(c),u)
+    if (u != 0 && u != 9)
+    {
+      auto path = d.getPath(0,u).second;
+      GL_ASSERT_EQUAL_DESC(tree.parent(u),path[path.size()-2],"Parent of "+std::to_string(u)+" precedes it on its path")
+    }
+  }
+  GL_TEST_CATCH_ERROR(tree.parent(10);,std::runtime_error,"ShortestPathTree::parent | Node index out of range.")
+  GL_TEST_END()
+}
+
 template <class SCALAR, class STORAGE, class DIRECTION>
 void TestEdgeSelector (const std::string& type)
 {
@@ -218,6 +251,420 @@ void TestNodeSelector (const std::string& type)
   GL_TEST_END()
 }
 
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestCacheRepair (const std::string& type)
+{
+  GL_TEST_BEGIN("Cache repair " << type)
+  gl::Graph<int,STORAGE,DIRECTION> g(9,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::Dijkstra<decltype(g)> d(g);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src)
+    d.pathLength(src,0);
+
+  // node modifications do not invalidate anything
+  g.updateNode(3,gl::Color("red"));
+  for (gl::index_type src = 0; src < g.numNodes(); ++src)
+    GL_ASSERT(d.isCached(src),std::to_string(src)+std::string(" should still be cached"))
+
+  // shortcut 0->4 improves the SPT of 0, which is repaired instead of recomputed
+  const std::size_t misses = d.cacheMisses();
+  g.setEdge(0,4,1);
+  GL_ASSERT(d.isCached(0),"SPT of 0 should be repaired")
+  GL_ASSERT_EQUAL(d.pathLength(0,4).scalarDistance(),1)
+  GL_ASSERT_EQUAL(d.pathLength(0,3).scalarDistance(),g.isDirected() ? 19 : 10)
+  GL_ASSERT_EQUAL(d.getShortestPathTree(0).parent(4),0)
+
+  // heavier tree edge: the subtree of 4 gets its old paths back
+  g.updateEdge(0,4,100);
+  GL_ASSERT_EQUAL(d.pathLength(0,4).scalarDistance(),g.isDirected() ? 28 : 21)
+  GL_ASSERT_EQUAL(d.pathLength(0,3).scalarDistance(),19)
+  GL_ASSERT(d.getPath(0,4).second.size() > 2,"0->4 should no longer be the shortest path")
+  GL_ASSERT_EQUAL(d.cacheMisses(),misses)
+
+  // compare all results with a fresh computation
+  g.delEdge(2,8);
+  g.updateEdge(6,7,20);
+  gl::algorithm::Dijkstra<decltype(g)> fresh(g);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src)
+  {
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest)
+    {
+      GL_ASSERT(d.pathLength(src,dest) == fresh.pathLength(src,dest),std::string("Stale path length from ")+std::to_string(src)+std::string(" to ")+std::to_string(dest))
+    }
+  }
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestAssignment (const std::string& type)
+{
+  GL_TEST_BEGIN("Graph assignment " << type)
+  using Graph = gl::Graph<SCALAR,STORAGE,DIRECTION>;
+  Graph g(9,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::Dijkstra<Graph> d(g);
+  gl::algorithm::BidirectionalDijkstra<Graph> bidirectional(g);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src)
+    d.pathLength(src,0);
+  bidirectional.pathLength(0,3);
+
+  // an assigned graph is a different graph, even if it has been modified fewer times
+  Graph same(9,type);
+  same.setEdge(0,3,SCALAR(1));
+  g = same;
+  GL_ASSERT_EQUAL(d.pathLength(0,3).scalarDistance(),SCALAR(1))
+  GL_ASSERT(d.pathLength(0,1).isInfinite(),"Edges of the replaced graph should be gone")
+
+  // the caches grow with the graph
+  Graph larger(20,type);
+  for (gl::index_type u = 0; u + 1 < larger.numNodes(); ++u)
+    larger.setEdge(u,u+1,SCALAR(2));
+  g = std::move(larger);
+  GL_ASSERT_EQUAL(d.pathLength(0,19).scalarDistance(),SCALAR(38))
+  GL_ASSERT_EQUAL(d.pathLength(19,0).isInfinite(),g.isDirected())
+  GL_ASSERT_EQUAL(d.getPath(0,19).second.size(),20)
+  GL_ASSERT_EQUAL(bidirectional.pathLength(0,19).scalarDistance(),SCALAR(38))
+
+  // and shrink with it
+  g = Graph(3,type);
+  g.setEdge(0,2,SCALAR(5));
+  GL_ASSERT_EQUAL(d.pathLength(0,2).scalarDistance(),SCALAR(5))
+  GL_ASSERT(d.pathLength(0,1).isInfinite(),"Edges of the replaced graph should be gone")
+  GL_ASSERT_EQUAL(bidirectional.pathLength(0,2).scalarDistance(),SCALAR(5))
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestRandomRepair (const std::string& type)
+{
+  GL_TEST_BEGIN("Random repair " << type)
+  using Graph = gl::Graph<SCALAR,STORAGE,DIRECTION>;
+  const gl::index_type n = 40;
+  Graph g(n,type);
+  std::mt19937 gen(48);
+  std::uniform_int_distribution<gl::index_type> node(0,n-1);
+  std::uniform_int_distribution<int> weight(1,20);
+  std::uniform_int_distribution<int> operation(0,3);
+  for (gl::index_type i = 0; i < 3*n; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(weight(gen)));
+  }
+  gl::algorithm::Dijkstra<Graph> d(g);
+  for (gl::index_type src = 0; src < n; src += 3)
+    d.pathLength(src,0);
+  const std::size_t misses = d.cacheMisses();
+
+  for (int round = 0; round < 50; ++round) {
+    // 1 to 3 modifications: decrease, increase, delete or insert
+    for (int change = round % 3; change >= 0; --change) {
+      gl::index_type u = node(gen), v = node(gen);
+      if (u == v) continue;
+      if (!g.hasEdge(u,v))
+        g.setEdge(u,v,SCALAR(weight(gen)));
+      else if (operation(gen) == 0)
+        g.delEdge(u,v);
+      else
+        g.updateEdge(u,v,SCALAR(weight(gen)));
+    }
+    gl::algorithm::Dijkstra<Graph> fresh(g);
+    for (gl::index_type src = 0; src < n; src += 3) {
+      GL_ASSERT(d.isCached(src),"Repaired sources should stay cached")
+      auto tree = d.getShortestPathTree(src);
+      for (gl::index_type dest = 0; dest < n; ++dest) {
+        auto length = d.pathLength(src,dest);
+        GL_ASSERT(length == fresh.pathLength(src,dest),std::string("Wrong repaired path length from ")+std::to_string(src)+std::string(" to ")+std::to_string(dest))
+        gl::index_type parent = tree.parent(dest);
+        GL_ASSERT(dest == src || length.isInfinite() || (g.hasEdge(parent,dest) && d.pathLength(src,parent).scalarDistance() + g.getEdgeWeight(parent,dest) == length.scalarDistance()),"Repaired predecessor is not on a shortest path")
+      }
+    }
+  }
+  GL_ASSERT_EQUAL(d.cacheMisses(),misses)
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestCacheLimits (const std::string& type)
+{
+  GL_TEST_BEGIN("Cache limits " << type)
+  gl::Graph<int,STORAGE,DIRECTION> g(9,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::Dijkstra<decltype(g)> d(g);
+  gl::algorithm::Dijkstra<decltype(g)> fresh(g);
+  d.setCacheCapacity(3);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src)
+    d.pathLength(src,0);
+  GL_ASSERT_EQUAL(d.numCached(),3)
+  GL_ASSERT_EQUAL(d.cacheMisses(),9)
+  GL_ASSERT_EQUAL(d.cacheHits(),0)
+  GL_ASSERT(d.isCached(6) && d.isCached(7) && d.isCached(8),"The three most recent sources are cached")
+
+  // a hit makes 6 the most recently used source, so 7 is evicted next
+  d.getPath(6,1);
+  d.pathLength(0,1);
+  GL_ASSERT_EQUAL(d.cacheHits(),1)
+  GL_ASSERT_EQUAL(d.cacheMisses(),10)
+  GL_ASSERT(d.isCached(6) && !d.isCached(7) && d.isCached(8) && d.isCached(0),"7 was the least recently used source")
+
+  // lowering the limits evicts right away, modifications are repaired in place
+  d.setCacheCapacity(2);
+  GL_ASSERT(!d.isCached(8),"8 was the least recently used source")
+  g.setEdge(0,4,1);
+  GL_ASSERT(d.isCached(0) && d.numCached() == 2,"0->4 does not evict source 0")
+  d.pathLength(3,0);
+  d.pathLength(4,0);
+  GL_ASSERT_EQUAL(d.numCached(),2)
+  d.setCacheMemoryLimit(1);
+  GL_ASSERT(d.isCached(4) && d.numCached() == 1,"The most recent source is kept even if it exceeds the budget")
+
+  // results do not depend on evictions
+  d.setCacheCapacity(0);
+  d.setCacheMemoryLimit(2 * g.numNodes() * sizeof(std::pair<gl::Distance<int>,gl::index_type>) + 64);
+  fresh.initialize(g);
+  d.resetCacheStatistics();
+  for (gl::index_type src = 0; src < g.numNodes(); ++src)
+  {
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest)
+      GL_ASSERT(d.getPath(src,dest) == fresh.getPath(src,dest),std::string("Wrong path from ")+std::to_string(src)+std::string(" to ")+std::to_string(dest))
+    GL_ASSERT(d.numCached() <= 2,"The memory budget allows two sources")
+  }
+  GL_ASSERT_EQUAL(d.cacheMisses(),g.numNodes())
+  GL_ASSERT_EQUAL(d.cacheHits(),g.numNodes() * (g.numNodes() - 1))
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestPointToPoint (const std::string& type)
+{
+  GL_TEST_BEGIN("Point-to-point queries " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::Dijkstra<decltype(g)> full(g);
+  gl::algorithm::Dijkstra<decltype(g)> query(g);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src) {
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+      auto expected = full.pathLength(src,dest);
+      auto length = query.queryLength(src,dest);
+      GL_ASSERT(length == expected,"queryLength differs from pathLength")
+      auto path = query.queryPath(src,dest);
+      GL_ASSERT(path.first == !expected.isInfinite(),"queryPath reports the wrong reachability")
+      if (!path.first) continue;
+      GL_ASSERT(path.second.front() == src && path.second.back() == dest,"queryPath has the wrong endpoints")
+      SCALAR sum = 0;
+      for (gl::index_type i = 1; i < path.second.size(); ++i)
+        sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+      GL_ASSERT_EQUAL(sum,expected.scalarDistance())
+    }
+  }
+  GL_ASSERT(!query.isCached(0),"Point-to-point queries must not fill the cache")
+
+  // all distances at once, with and without a cached result
+  std::vector<gl::Distance<SCALAR>> distances, cached;
+  std::vector<gl::index_type> predecessors;
+  for (gl::index_type src = 0; src < g.numNodes(); src += 4) {
+    query.queryDistances(src,distances,predecessors);
+    full.queryDistances(src,cached);
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+      GL_ASSERT(distances[dest] == full.pathLength(src,dest),"queryDistances differs from pathLength")
+      GL_ASSERT(cached[dest] == distances[dest],"queryDistances differs between cached and uncached sources")
+      if (dest != src && !distances[dest].isInfinite())
+        GL_ASSERT(g.hasEdge(predecessors[dest],dest),"queryDistances returns a wrong predecessor")
+    }
+  }
+  GL_ASSERT(!query.isCached(0),"queryDistances must not fill the cache")
+
+  // the workspace follows graph modifications
+  g.updateEdge(0,1,SCALAR(1));
+  GL_ASSERT_EQUAL(query.queryLength(0,1).scalarDistance(),SCALAR(1))
+  g.updateEdge(0,1,SCALAR(-1));
+  GL_TEST_CATCH_ERROR(query.queryLength(0,1);,std::runtime_error,"Dijkstra::search | Found non-positive edge weights in the graph.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestWeightRanges (const std::string& type)
+{
+  GL_TEST_BEGIN("Small and large weights " << type)
+  // small weights use Dial's buckets on integer graphs, large weights the radix heap
+  for (int maxWeight : {1, 20, 100000}) {
+    gl::Graph<SCALAR,STORAGE,DIRECTION> g(60,type);
+    std::mt19937 gen(maxWeight);
+    std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+    std::uniform_int_distribution<int> weight(1,maxWeight);
+    for (int i = 0; i < 200; ++i) {
+      gl::index_type u = node(gen), v = node(gen);
+      if (u != v && !g.hasEdge(u,v)) g.setEdge(u,v,SCALAR(weight(gen)));
+    }
+    gl::algorithm::Dijkstra<decltype(g)> full(g);
+    gl::algorithm::Dijkstra<decltype(g)> query(g);
+    std::vector<gl::Distance<SCALAR>> distances;
+    for (gl::index_type src = 0; src < g.numNodes(); src += 7) {
+      query.queryDistances(src,distances);
+      for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+        GL_ASSERT(full.pathLength(src,dest) == distances[dest],"Full search differs from the point-to-point workspace")
+        auto path = full.getPath(src,dest);
+        if (!path.first) continue;
+        SCALAR sum = 0;
+        for (gl::index_type i = 1; i < path.second.size(); ++i)
+          sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+        GL_ASSERT_EQUAL(sum,distances[dest].scalarDistance())
+      }
+    }
+  }
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestDenseGraph (const std::string& type)
+{
+  GL_TEST_BEGIN("Dense graph " << type)
+  // complete graph: the Matrix search scans rows, the List search uses a priority queue
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(40,type);
+  std::mt19937 gen(40);
+  std::uniform_int_distribution<int> weight(1,20);
+  for (gl::index_type u = 0; u < g.numNodes(); ++u)
+    for (gl::index_type v = 0; v < g.numNodes(); ++v)
+      if (u != v && !g.hasEdge(u,v)) g.setEdge(u,v,SCALAR(weight(gen)));
+  auto row = g.getEdgeRow(3);
+  GL_ASSERT(!row[3].exists() && row[5].exists(),"Wrong row contents")
+  GL_ASSERT_EQUAL(row[5].weight(),g.getEdgeWeight(3,5))
+  GL_ASSERT_EQUAL(row[0].exists(),g.isDirected()) // undirected graphs store the upper triangle
+  auto list = g.toList();
+  gl::algorithm::Dijkstra<decltype(g)> dense(g);
+  gl::algorithm::Dijkstra<decltype(list)> sparse(list);
+  for (gl::index_type src = 0; src < g.numNodes(); src += 3) {
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+      GL_ASSERT(dense.pathLength(src,dest) == sparse.pathLength(src,dest),"Matrix and List searches differ")
+      auto path = dense.getPath(src,dest);
+      SCALAR sum = 0;
+      for (gl::index_type i = 1; i < path.second.size(); ++i)
+        sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+      GL_ASSERT_EQUAL(sum,dense.pathLength(src,dest).scalarDistance())
+    }
+  }
+  GL_TEST_END()
+}
+
+template <class ALGEBRA, class Graph>
+void comparePathAlgebra (Graph& g, std::mt19937& gen, const std::vector<typename Graph::val_t>& weights)
+{
+  using val_t = typename Graph::val_t;
+  const gl::index_type n = g.numNodes();
+  std::uniform_int_distribution<gl::index_type> node(0,n-1);
+  std::uniform_int_distribution<std::size_t> pick(0,weights.size()-1);
+  // fixpoint of the algebra's Bellman equations as reference
+  auto reference = [&g,n](const gl::index_type src) {
+    std::vector<val_t> value(n, ALGEBRA::zero());
+    value[src] = ALGEBRA::one();
+    for (bool changed = true; changed;) {
+      changed = false;
+      for (gl::index_type u = 0; u < n; ++u) {
+        if (value[u] == ALGEBRA::zero()) continue;
+        for (auto x : g.getNeighbourWeights(u)) {
+          val_t candidate = ALGEBRA::extend(value[u], x.second);
+          if (x.first != u && ALGEBRA::better(candidate, value[x.first])) {
+            value[x.first] = candidate;
+            changed = true;
+          }
+        }
+      }
+    }
+    return value;
+  };
+  gl::algorithm::Dijkstra<Graph,ALGEBRA> d(g);
+  std::vector<gl::Distance<val_t,ALGEBRA>> distances;
+  for (int round = 0; round < 10; ++round) {
+    for (gl::index_type src = 0; src < n; src += 5) {
+      GL_ASSERT(round == 0 || d.isCached(src),"Repaired sources should stay cached")
+      auto expected = reference(src);
+      gl::algorithm::Dijkstra<Graph,ALGEBRA>(g).queryDistances(src,distances);
+      for (gl::index_type dest = 0; dest < n; ++dest) {
+        auto value = d.pathLength(src,dest);
+        GL_ASSERT(value.scalarDistance() == expected[dest],std::string("Wrong path value from ")+std::to_string(src)+std::string(" to ")+std::to_string(dest))
+        GL_ASSERT(distances[dest] == value,"Point-to-point workspace differs from the full search")
+        GL_ASSERT(value.isInfinite() == (expected[dest] == ALGEBRA::zero()),"isInfinite does not match the value of no path")
+        auto path = d.getPath(src,dest);
+        GL_ASSERT(path.first == !value.isInfinite(),"getPath reports the wrong reachability")
+        if (!path.first) continue;
+        gl::Distance<val_t,ALGEBRA> combined(ALGEBRA::one());
+        for (gl::index_type i = 1; i < path.second.size(); ++i)
+          combined = combined + gl::Distance<val_t,ALGEBRA>(g.getEdgeWeight(path.second[i-1],path.second[i]));
+        GL_ASSERT(combined == value,"The path does not have the computed value")
+      }
+    }
+    // the cached sources are repaired in the algebra
+    for (int change = 0; change < 3; ++change) {
+      gl::index_type u = node(gen), v = node(gen);
+      if (u == v) continue;
+      if (!g.hasEdge(u,v))
+        g.setEdge(u,v,weights[pick(gen)]);
+      else if (change == 0)
+        g.delEdge(u,v);
+      else
+        g.updateEdge(u,v,weights[pick(gen)]);
+    }
+  }
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestBottleneck (const std::string& type)
+{
+  GL_TEST_BEGIN("Bottleneck paths " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(30,type);
+  std::mt19937 gen(50);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  // capacities may be zero or negative, few distinct values give many ties
+  std::vector<SCALAR> capacities {SCALAR(-2), SCALAR(0), SCALAR(1), SCALAR(3), SCALAR(7), SCALAR(12)};
+  std::uniform_int_distribution<std::size_t> pick(0,capacities.size()-1);
+  for (int i = 0; i < 70; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v)) g.setEdge(u,v,capacities[pick(gen)]);
+  }
+  comparePathAlgebra<gl::MaxMin<SCALAR>>(g,gen,capacities);
+
+  gl::Graph<SCALAR,STORAGE,DIRECTION> line(4,type);
+  line.setEdge(0,1,SCALAR(5));
+  line.setEdge(1,2,SCALAR(2));
+  line.setEdge(0,2,SCALAR(1));
+  gl::algorithm::Dijkstra<decltype(line),gl::MaxMin<SCALAR>> widest(line);
+  GL_ASSERT_EQUAL(widest.pathLength(0,2).scalarDistance(),SCALAR(2))
+  GL_ASSERT_EQUAL(widest.pathLength(0,0).scalarDistance(),GL_INF(SCALAR))
+  GL_ASSERT(widest.pathLength(0,3).isInfinite(),"Node 3 is unreachable")
+  GL_ASSERT_EQUAL(widest.queryPath(0,2).second.size(),3)
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestReliability (const std::string& type)
+{
+  GL_TEST_BEGIN("Most reliable paths " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(30,type);
+  std::mt19937 gen(51);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  std::vector<SCALAR> probabilities {SCALAR(0), SCALAR(0.1), SCALAR(0.5), SCALAR(0.75), SCALAR(0.9), SCALAR(1)};
+  std::uniform_int_distribution<std::size_t> pick(0,probabilities.size()-1);
+  for (int i = 0; i < 70; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v)) g.setEdge(u,v,probabilities[pick(gen)]);
+  }
+  comparePathAlgebra<gl::MaxProduct<SCALAR>>(g,gen,probabilities);
+
+  gl::Graph<SCALAR,STORAGE,DIRECTION> line(4,type);
+  line.setEdge(0,1,SCALAR(0.5));
+  line.setEdge(1,2,SCALAR(0.5));
+  line.setEdge(0,2,SCALAR(0.2));
+  line.setEdge(2,3,SCALAR(0));
+  gl::algorithm::Dijkstra<decltype(line),gl::MaxProduct<SCALAR>> reliable(line);
+  GL_ASSERT_EQUAL(reliable.pathLength(0,2).scalarDistance(),SCALAR(0.25))
+  GL_ASSERT_EQUAL(reliable.pathLength(0,0).scalarDistance(),SCALAR(1))
+  GL_ASSERT(reliable.pathLength(0,3).isInfinite(),"An edge with probability 0 does not reach node 3")
+  GL_ASSERT(!reliable.queryPath(0,3).first,"An edge with probability 0 does not reach node 3")
+  line.updateEdge(0,1,SCALAR(1.5));
+  GL_TEST_CATCH_ERROR(reliable.pathLength(1,2);,std::runtime_error,"Dijkstra::compute | Found edge weights outside of [0,1] in the graph.")
+  GL_TEST_CATCH_ERROR(reliable.queryLength(1,2);,std::runtime_error,"Dijkstra::search | Found edge weights outside of [0,1] in the graph.")
+  GL_TEST_END()
+}
+
 int main(int argc, char const *argv[])
 {
   GL_TEST_FUNCTION_WITH_ALL_TYPES(TestEmptyConstructor)
@@ -228,8 +675,21 @@ int main(int argc, char const *argv[])
   GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestGetPathDirected,int)
   GL_TEST_FUNCTION_WITH_UNDIRECTED_TYPES(TestGetSPTUndirected,int)
   GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestGetSPTDirected,int)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestShortestPathTree)
   GL_TEST_FUNCTION_WITH_ALL_TYPES(TestNodeSelector)
   GL_TEST_FUNCTION_WITH_ALL_TYPES(TestEdgeSelector)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestCacheRepair)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestAssignment)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestRandomRepair)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestCacheLimits)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestPointToPoint)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestWeightRanges)
+  GL_TEST_FUNCTION_WITH_MATRIX_TYPES(TestDenseGraph,int)
+  GL_TEST_FUNCTION_WITH_MATRIX_TYPES(TestDenseGraph,double)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestBottleneck)
+  GL_TEST_FUNCTION_WITH_MATRIX_TYPES(TestReliability,double)
+  GL_TEST_FUNCTION_WITH_LIST_TYPES(TestReliability,double)
+  GL_TEST_FUNCTION_WITH_LIST_TYPES(TestReliability,float)
 
   return 0;
 }
@@ -0,0 +1,98 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+void TestInfinity ()
+{
+  GL_TEST_BEGIN("Infinity")
+  const gl::Distance<int> inf;
+  const gl::Distance<int> zero(0);
+  GL_ASSERT(inf.isInfinite(), "Default Distance should be infinite")
+  GL_ASSERT(!zero.isInfinite(), "Distance 0 should be finite")
+  GL_ASSERT(zero.isZero(), "Distance 0 should be zero")
+  GL_ASSERT(!inf.isZero(), "Infinite Distance should not be zero")
+  GL_ASSERT_EQUAL_DESC(inf.scalarDistance(), GL_INF(int), "Infinite Distance should have scalar value GL_INF")
+  GL_ASSERT(inf.getDistance() == "Inf", "Infinite Distance should print as Inf")
+  GL_ASSERT_EQUAL_DESC(sizeof(gl::Distance<float>), sizeof(float), "Distance should have the size of its scalar")
+
+  gl::Distance<double> d(2.5);
+  d.setInfinite();
+  GL_ASSERT(d.isInfinite(), "setInfinite should make the Distance infinite")
+  d.setDistance(1.5);
+  GL_ASSERT_EQUAL_DESC(d.scalarDistance(), 1.5, "setDistance should make the Distance finite")
+  GL_TEST_END()
+}
+
+void TestComparison ()
+{
+  GL_TEST_BEGIN("Comparison")
+  const gl::Distance<int> inf;
+  const gl::Distance<int> one(1);
+  const gl::Distance<int> two(2);
+  GL_ASSERT(one < two, "1 should be less than 2")
+  GL_ASSERT(two > one, "2 should be greater than 1")
+  GL_ASSERT(one < inf, "1 should be less than infinity")
+  GL_ASSERT(!(inf < inf), "Infinity should not be less than infinity")
+  GL_ASSERT(!(inf > inf), "Infinity should not be greater than infinity")
+  GL_ASSERT(inf == gl::Distance<int>(), "Infinities should be equal")
+  GL_ASSERT(one != two, "1 should not be equal to 2")
+  GL_ASSERT(gl::Distance<int>(-3) < one, "-3 should be less than 1")
+  GL_ASSERT(gl::Distance<int>::min(two, one) == one, "min(2,1) should be 1")
+  GL_ASSERT(gl::Distance<int>::min(inf, two) == two, "min(Inf,2) should be 2")
+  GL_ASSERT(gl::Distance<int>::min(inf, inf).isInfinite(), "min(Inf,Inf) should be infinite")
+  GL_TEST_END()
+}
+
+void TestSaturatingAddition ()
+{
+  GL_TEST_BEGIN("Saturating addition")
+  const gl::Distance<int> inf;
+  const gl::Distance<int> big(GL_INF(int) - 1);
+  GL_ASSERT_EQUAL_DESC((gl::Distance<int>(2) + gl::Distance<int>(3)).scalarDistance(), 5, "2+3 should be 5")
+  GL_ASSERT_EQUAL_DESC((gl::Distance<int>(2) + gl::Distance<int>(-3)).scalarDistance(), -1, "2-3 should be -1")
+  GL_ASSERT((inf + gl::Distance<int>(-3)).isInfinite(), "Infinity minus 3 should stay infinite")
+  GL_ASSERT((gl::Distance<int>(-3) + inf).isInfinite(), "-3 plus infinity should be infinite")
+  GL_ASSERT((big + big).isInfinite(), "Overflowing sums should saturate to infinity")
+  GL_ASSERT_EQUAL_DESC((gl::Distance<int>(std::numeric_limits<int>::lowest()) + gl::Distance<int>(-1)).scalarDistance(),
+                       std::numeric_limits<int>::lowest(), "Underflowing sums should saturate to the lowest value")
+  GL_ASSERT((gl::Distance<unsigned>(GL_INF(unsigned) - 1) + gl::Distance<unsigned>(5)).isInfinite(), "Overflowing unsigned sums should saturate to infinity")
+  GL_ASSERT((gl::Distance<float>(GL_INF(float)) + gl::Distance<float>(-1.f)).isInfinite(), "Infinite float minus 1 should stay infinite")
+  GL_ASSERT((gl::Distance<double>(GL_INF(double) / 2) + gl::Distance<double>(GL_INF(double))).isInfinite(), "Overflowing float sums should saturate to infinity")
+  GL_ASSERT_EQUAL_DESC((gl::Distance<double>(0.5) + gl::Distance<double>(0.25)).scalarDistance(), 0.75, "0.5+0.25 should be 0.75")
+  static_assert((gl::Distance<int>(1) + gl::Distance<int>(2)) < gl::Distance<int>(), "Distance operators should be usable in constant expressions");
+  GL_TEST_END()
+}
+
+void TestPathAlgebras ()
+{
+  GL_TEST_BEGIN("Path algebras")
+  using Widest = gl::Distance<int,gl::MaxMin<int>>;
+  GL_ASSERT(Widest().isInfinite(), "Default Distance should be the value of no path")
+  GL_ASSERT_EQUAL_DESC(Widest().scalarDistance(), std::numeric_limits<int>::lowest(), "No path should have the lowest capacity")
+  GL_ASSERT(!Widest(GL_INF(int)).isInfinite(), "The empty path has an unlimited capacity")
+  GL_ASSERT_EQUAL_DESC((Widest(5) + Widest(3)).scalarDistance(), 3, "Extending a path should keep the smaller capacity")
+  GL_ASSERT((Widest() + Widest(3)).isInfinite(), "Extending no path should give no path")
+  GL_ASSERT(gl::MaxMin<int>::better(5, 3), "A wider path should be preferred")
+  GL_ASSERT(gl::MaxMin<int>::priority(5) < gl::MaxMin<int>::priority(3), "A wider path should be queued first")
+  GL_ASSERT(gl::MaxMin<int>::priority(gl::MaxMin<int>::one()) < GL_INF(int), "The empty path should be queued")
+
+  using Reliable = gl::Distance<double,gl::MaxProduct<double>>;
+  GL_ASSERT(Reliable().isInfinite(), "Default Distance should be the value of no path")
+  GL_ASSERT_EQUAL_DESC(Reliable().scalarDistance(), 0., "No path should have probability 0")
+  GL_ASSERT_EQUAL_DESC((Reliable(0.5) + Reliable(0.25)).scalarDistance(), 0.125, "Extending a path should multiply the probabilities")
+  GL_ASSERT((Reliable(0.5) + Reliable()).isInfinite(), "Extending by an edge of probability 0 should give no path")
+  GL_ASSERT(gl::MaxProduct<double>::priority(0.5) < gl::MaxProduct<double>::priority(0.25), "A more reliable path should be queued first")
+
+  static_assert(gl::MinPlus<int>::extend(gl::MinPlus<int>::one(), 4) == 4, "The empty path should be neutral");
+  static_assert(gl::MaxMin<int>::extend(gl::MaxMin<int>::one(), 4) == 4, "The empty path should be neutral");
+  static_assert(gl::MaxProduct<double>::extend(gl::MaxProduct<double>::one(), 0.5) == 0.5, "The empty path should be neutral");
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  TestInfinity();
+  TestComparison();
+  TestSaturatingAddition();
+  TestPathAlgebras();
+  return 0;
+}
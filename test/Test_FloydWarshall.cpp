@@ -1,6 +1,7 @@
 #include <graphlib/gl>
 #include "gl_test.hpp"
 
+#include <random>
 #include <vector>
 #include <utility> // for std::pair
 
@@ -170,6 +171,165 @@ void TestGetSPTDirected (const std::string& type)
   GL_TEST_END()
 }
 
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestShortestPathTree (const std::string& type)
+{
+  GL_TEST_BEGIN("Shortest path tree view " << type)
+  gl::Graph<int,STORAGE,DIRECTION> g(10,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::FloydWarshall<decltype(g)> d(g);
+  auto tree = d.getShortestPathTree(0);
+  auto spt = d.getSPT(0);
+  GL_ASSERT_EQUAL(tree.numNodes(),10)
+  GL_ASSERT_EQUAL(tree.numEdges(),8)
+  GL_ASSERT_EQUAL(tree.source(),0)
+  GL_ASSERT(tree.isReached(0),"The source is part of the tree")
+  GL_ASSERT(!tree.isReached(9),"Node 9 is not connected to 0")
+  GL_ASSERT_EQUAL(tree.parent(9),9)
+  GL_ASSERT_EQUAL(tree.children(9).size(),0)
+  for (gl::index_type u = 0; u < 10; ++u)
+  {
+    for (gl::index_type v = 0; v < 10; ++v)
+      GL_ASSERT_EQUAL_DESC(tree.hasEdge(u,v),spt.hasEdge(u,v),"Edge "+std::to_string(u)+"->"+std::to_string(v))
+    for (auto c : tree.children(u))
+      GL_ASSERT_EQUAL(tree.parent(c),u)
+    if (u != 0 && u != 9)
+    {
+      auto path = d.getPath(0,u).second;
+      GL_ASSERT_EQUAL_DESC(tree.parent(u),path[path.size()-2],"Parent of "+std::to_string(u)+" precedes it on its path")
+    }
+  }
+  GL_TEST_CATCH_ERROR(tree.parent(10);,std::runtime_error,"ShortestPathTree::parent | Node index out of range.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestParallel (const std::string& type)
+{
+  GL_TEST_BEGIN("Parallel kernel " << type)
+  using Graph = gl::Graph<SCALAR,STORAGE,DIRECTION>;
+  const gl::index_type n = gl::algorithm::FloydWarshall<Graph>::parallelThreshold + 4;
+  Graph g(n,type);
+  std::mt19937 gen(45);
+  std::uniform_int_distribution<gl::index_type> node(0,n-1);
+  std::uniform_int_distribution<int> weight(1,20);
+  for (gl::index_type i = 0; i < 3*n; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(weight(gen)));
+  }
+  gl::algorithm::FloydWarshall<Graph> parallel(g,4);
+  gl::algorithm::FloydWarshall<Graph> sequential(g,1);
+  gl::algorithm::Dijkstra<Graph> reference(g);
+  for (gl::index_type src = 0; src < n; ++src) {
+    for (gl::index_type dest = 0; dest < n; ++dest) {
+      auto length = parallel.pathLength(src,dest);
+      GL_ASSERT(length == sequential.pathLength(src,dest),"Distances depend on the number of threads")
+      GL_ASSERT(parallel.getPath(src,dest) == sequential.getPath(src,dest),"Paths depend on the number of threads")
+      GL_ASSERT(length == reference.pathLength(src,dest),"Distances differ from Dijkstra")
+    }
+  }
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestUpdate (const std::string& type)
+{
+  GL_TEST_BEGIN("Incremental update " << type)
+  using Graph = gl::Graph<SCALAR,STORAGE,DIRECTION>;
+  const gl::index_type n = 30;
+  Graph g(n,type);
+  std::mt19937 gen(47);
+  std::uniform_int_distribution<gl::index_type> node(0,n-1);
+  std::uniform_int_distribution<int> weight(1,20);
+  std::uniform_int_distribution<int> operation(0,3);
+  for (gl::index_type i = 0; i < 2*n; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(weight(gen)));
+  }
+  gl::algorithm::FloydWarshall<Graph> d(g);
+  GL_ASSERT(d.update(),"Update without modifications should not recompute")
+
+  for (int round = 0; round < 60; ++round) {
+    // 1 to 3 modifications: decrease, increase, delete or insert
+    for (int change = round % 3; change >= 0; --change) {
+      gl::index_type u = node(gen), v = node(gen);
+      if (u == v) continue;
+      if (!g.hasEdge(u,v))
+        g.setEdge(u,v,SCALAR(weight(gen)));
+      else if (operation(gen) == 0)
+        g.delEdge(u,v);
+      else
+        g.updateEdge(u,v,SCALAR(weight(gen)));
+    }
+    GL_ASSERT(d.update(),"Update should be incremental")
+    gl::algorithm::FloydWarshall<Graph> reference(g);
+    for (gl::index_type src = 0; src < n; ++src) {
+      for (gl::index_type dest = 0; dest < n; ++dest) {
+        auto length = d.pathLength(src,dest);
+        GL_ASSERT(length == reference.pathLength(src,dest),"Updated distances differ from a recomputation")
+        auto path = d.getPath(src,dest);
+        GL_ASSERT(path.first != length.isInfinite(),"Path existence does not match the distance")
+        SCALAR sum = 0;
+        for (gl::index_type i = 1; i < path.second.size(); ++i) {
+          GL_ASSERT(g.hasEdge(path.second[i-1],path.second[i]),"Updated path uses a missing edge")
+          sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+        }
+        GL_ASSERT(!path.first || sum == length.scalarDistance(),"Updated path does not have the shortest length")
+      }
+    }
+  }
+
+  // a single decrease
+  gl::index_type u = 0;
+  while (g.hasEdge(u,u+1)) ++u;
+  g.setEdge(u,u+1,SCALAR(1));
+  GL_ASSERT(d.update(),"Inserting an edge should be incremental")
+  GL_ASSERT_EQUAL_DESC(d.pathLength(u,u+1).scalarDistance(),SCALAR(1),"Inserted edge should be the shortest path")
+  GL_ASSERT_EQUAL_DESC(d.getPath(u,u+1).second.size(),2,"Inserted edge should be the shortest path")
+
+  // modifications that are no longer in the change log lead to a recomputation
+  for (int i = 0; i <= GL_CHANGE_LOG_CAPACITY; ++i)
+    g.updateEdge(u,u+1,SCALAR(1 + i % 2));
+  GL_ASSERT(!d.update(),"Update after a change log overflow should recompute")
+  GL_ASSERT_EQUAL_DESC(d.pathLength(u,u+1).scalarDistance(),SCALAR(1),"Recomputed distance is wrong")
+
+  // so does assigning another graph, whatever its generation
+  Graph other(n,type);
+  other.setEdge(u,n-1,SCALAR(3));
+  g = other;
+  GL_ASSERT(!d.update(),"Update after an assignment should recompute")
+  GL_ASSERT(d.pathLength(u,u+1).isInfinite(),"Edges of the replaced graph should be gone")
+  GL_ASSERT_EQUAL_DESC(d.pathLength(u,n-1).scalarDistance(),SCALAR(3),"Recomputed distance is wrong")
+
+  GL_TEST_CATCH_ERROR({gl::algorithm::FloydWarshall<Graph> e; e.update();},std::runtime_error,"FloydWarshall::update | FloydWarshall has not been initialized with a graph.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestUpdateNegativeCycle (const std::string& type)
+{
+  GL_TEST_BEGIN("Incremental update with negative cycle " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(3,type);
+  g.setEdge(0,1,-2);
+  g.setEdge(1,2,-1);
+  g.setEdge(2,0,5);
+  gl::algorithm::FloydWarshall<decltype(g)> d(g);
+  GL_ASSERT(!d.hasNegativePath(),"There should be no negative cycle yet")
+  g.updateEdge(2,0,SCALAR(3));
+  GL_ASSERT(d.update(),"Decrease without negative cycle should be incremental")
+  GL_ASSERT_EQUAL_DESC(d.pathLength(2,1).scalarDistance(),SCALAR(1),"Path length from 2 to 1 should be 1")
+  g.updateEdge(2,0,SCALAR(2));
+  GL_ASSERT(!d.update(),"Closing a negative cycle should recompute")
+  GL_ASSERT(d.hasNegativePath(),"The negative cycle was not detected")
+  g.updateEdge(2,0,SCALAR(6));
+  GL_ASSERT(!d.update(),"Tables with a negative cycle should be recomputed")
+  GL_ASSERT(!d.hasNegativePath(),"The negative cycle should be gone")
+  GL_ASSERT_EQUAL_DESC(d.pathLength(2,1).scalarDistance(),SCALAR(4),"Path length from 2 to 1 should be 4")
+  GL_TEST_END()
+}
+
 template <class SCALAR, class STORAGE, class DIRECTION>
 void TestEdgeSelector (const std::string& type)
 {
@@ -237,6 +397,11 @@ int main(int argc, char const *argv[])
   GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestGetPathDirected,int)
   GL_TEST_FUNCTION_WITH_UNDIRECTED_TYPES(TestGetSPTUndirected,int)
   GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestGetSPTDirected,int)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestShortestPathTree)
+  GL_TEST_FUNCTION_WITH_LIST_TYPES(TestParallel,int)
+  GL_TEST_FUNCTION_WITH_MATRIX_TYPES(TestParallel,double)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestUpdate)
+  GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestUpdateNegativeCycle,int)
   GL_TEST_FUNCTION_WITH_ALL_TYPES(TestNodeSelector)
   GL_TEST_FUNCTION_WITH_ALL_TYPES(TestEdgeSelector)
 
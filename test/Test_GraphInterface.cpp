@@ -505,6 +505,74 @@ void TestDeleteEdge (const std::string& type) {
   GL_TEST_END()
 }
 
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestGeneration (const std::string& type) {
+  GL_TEST_BEGIN("Generation " << type)
+
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(5);
+  auto start = g.generation();
+  g.setEdge(0,1);
+  g.setEdge(2,3);
+  g.updateEdge(0,1,SCALAR(4));
+  g.updateNode(4,gl::Color("red"));
+  g.delEdge(2,3);
+  GL_ASSERT_EQUAL(g.generation(),start+5)
+
+  auto changes = g.getEdgeChangesSince(start);
+  GL_ASSERT(changes.first,"Change log should cover all modifications")
+  typename gl::Graph<SCALAR,STORAGE,DIRECTION>::edge_change_list_t expected {{0,1},{2,3},{0,1},{2,3}};
+  GL_ASSERT(changes.second == expected,"Wrong list of modified edges")
+  changes = g.getEdgeChangesSince(start+3);
+  expected = {{2,3}};
+  GL_ASSERT(changes.second == expected,"Wrong list of modified edges")
+  GL_ASSERT(g.getEdgeChangesSince(g.generation()).second.empty(),"No changes expected")
+
+  // overflowing the log
+  auto middle = g.generation();
+  for (gl::index_type i = 0; i <= GL_CHANGE_LOG_CAPACITY; ++i)
+    g.updateEdge(0,1,SCALAR(i));
+  GL_ASSERT(!g.getEdgeChangesSince(middle).first,"Change log should be truncated")
+  GL_ASSERT(g.getEdgeChangesSince(middle+1).first,"Change log should still cover the most recent modifications")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestEdgeStatistics (const std::string& type) {
+  GL_TEST_BEGIN("Edge statistics " << type)
+
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(5);
+  GL_ASSERT_EQUAL(g.maxDegree(),0)
+  g.setEdge(0,1,SCALAR(3));
+  g.setEdge(0,2,SCALAR(7));
+  g.setEdge(3,3,SCALAR(-1));
+  g.setEdge(1,4,SCALAR(0));
+  GL_ASSERT_EQUAL(g.numSelfLoops(),1)
+  GL_ASSERT_EQUAL(g.numNegativeEdges(),1)
+  GL_ASSERT_EQUAL(g.numNonPositiveEdges(),1)
+  GL_ASSERT_EQUAL(g.minEdgeWeight(),SCALAR(-1))
+  GL_ASSERT_EQUAL(g.maxEdgeWeight(),SCALAR(7))
+  GL_ASSERT_EQUAL(g.maxDegree(),2)
+
+  g.updateEdge(1,4,SCALAR(2));
+  g.updateEdge(0,2,gl::Color("red"));
+  g.delEdge(3,3);
+  g.delEdge(0,2);
+  GL_ASSERT_EQUAL(g.numSelfLoops(),0)
+  GL_ASSERT_EQUAL(g.numNegativeEdges(),0)
+  GL_ASSERT_EQUAL(g.numNonPositiveEdges(),0)
+  GL_ASSERT_EQUAL(g.minEdgeWeight(),SCALAR(2))
+  GL_ASSERT_EQUAL(g.maxEdgeWeight(),SCALAR(3))
+  GL_ASSERT_EQUAL(g.maxDegree(),g.isDirected() ? 1 : 2)
+
+  // statistics must match a graph built from scratch
+  gl::Graph<SCALAR,STORAGE,DIRECTION> h(5);
+  h.setEdge(0,1,SCALAR(3));
+  h.setEdge(1,4,SCALAR(2));
+  GL_ASSERT_EQUAL(g.maxDegree(),h.maxDegree())
+  GL_ASSERT_EQUAL(g.minEdgeWeight(),h.minEdgeWeight())
+  GL_TEST_END()
+}
+
 int main(int argc, char const *argv[])
 {
   GL_TEST_FUNCTION_WITH_ALL_TYPES(TestSetEdge)
@@ -520,6 +588,8 @@ int main(int argc, char const *argv[])
   GL_TEST_FUNCTION_WITH_UNDIRECTED_TYPES(TestUndirectedNodeDegrees,float)
   GL_TEST_FUNCTION_WITH_UNDIRECTED_TYPES(TestUndirectedNodeDegrees,double)
   GL_TEST_FUNCTION_WITH_ALL_TYPES(TestNeighbours)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestGeneration)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestEdgeStatistics)
 
   return 0;
 }
@@ -0,0 +1,65 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+#include <random>
+
+template <class Graph>
+void compareWithDijkstra (Graph& g, const gl::algorithm::HubLabels<Graph>& labels)
+{
+  gl::algorithm::Dijkstra<Graph> reference(g);
+  for (gl::index_type src = 0; src < g.numNodes(); ++src)
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest)
+      GL_ASSERT(labels.pathLength(src,dest) == reference.pathLength(src,dest),"Hub labels differ from Dijkstra")
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestSmall (const std::string& type)
+{
+  GL_TEST_BEGIN("Hub labels small " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::HubLabels<decltype(g)> labels(g);
+  GL_ASSERT_EQUAL(labels.numNodes(),10)
+  compareWithDijkstra(g,labels);
+  // every node is its own hub, so there are at least n entries per direction
+  GL_ASSERT(labels.numEntries() >= (g.isDirected() ? 20 : 10),"Labels are missing entries")
+  GL_ASSERT(labels.averageLabelSize() >= 1.,"Labels are missing entries")
+  GL_TEST_CATCH_ERROR(gl::algorithm::HubLabels<decltype(g)> bad(g,{0,1,2});,std::runtime_error,
+                      "HubLabels::build | The order is not a permutation of the nodes.")
+  g.updateEdge(0,1,SCALAR(-1));
+  GL_TEST_CATCH_ERROR(gl::algorithm::HubLabels<decltype(g)> bad(g);,std::runtime_error,
+                      "HubLabels::build | Found non-positive edge weights in the graph.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestRandom (const std::string& type)
+{
+  GL_TEST_BEGIN("Hub labels random " << type)
+  using Graph = gl::Graph<SCALAR,STORAGE,DIRECTION>;
+  Graph g(80,type);
+  std::mt19937 gen(36);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  std::uniform_int_distribution<int> weight(1,20);
+  for (int i = 0; i < 240; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(weight(gen)));
+  }
+  gl::algorithm::HubLabels<Graph> labels(g);
+  compareWithDijkstra(g,labels);
+  // any order yields exact distances, here the reversed contraction order of a hierarchy
+  gl::algorithm::ContractionHierarchies<Graph> ch(g,1);
+  typename Graph::idx_list_t order(g.numNodes());
+  for (gl::index_type u = 0; u < g.numNodes(); ++u)
+    order[g.numNodes() - 1 - ch.rank(u)] = u;
+  gl::algorithm::HubLabels<Graph> ordered(g,order);
+  compareWithDijkstra(g,ordered);
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestSmall)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestRandom)
+  return 0;
+}
@@ -0,0 +1,65 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+#include <random>
+
+template <unsigned ARITY>
+void TestHeapSort ()
+{
+  GL_TEST_BEGIN("Indexed " << ARITY << "-ary heap sort")
+  const gl::index_type n = 500;
+  std::mt19937 gen(37);
+  std::uniform_real_distribution<double> key(0.,1000.);
+  gl::IndexedDaryHeap<double,ARITY> heap(n);
+  std::vector<double> keys(n);
+  for (gl::index_type i = 0; i < n; ++i) {
+    keys[i] = key(gen);
+    heap.push(i,keys[i]);
+  }
+  GL_ASSERT_EQUAL(heap.size(),n)
+  // lower every third key, larger candidates are ignored
+  for (gl::index_type i = 0; i < n; i += 3) {
+    GL_ASSERT(!heap.pushOrDecrease(i,keys[i] + 1.),"A larger key must not be accepted")
+    keys[i] /= 2.;
+    GL_ASSERT(heap.pushOrDecrease(i,keys[i]),"A smaller key must be accepted")
+    GL_ASSERT_EQUAL(heap.key(i),keys[i])
+  }
+  std::vector<std::pair<double,gl::index_type>> expected;
+  for (gl::index_type i = 0; i < n; ++i)
+    expected.emplace_back(keys[i],i);
+  std::sort(expected.begin(),expected.end());
+  for (gl::index_type i = 0; i < n; ++i) {
+    auto top = heap.pop();
+    GL_ASSERT_EQUAL(top.first,expected[i].first)
+    GL_ASSERT(!heap.contains(top.second),"Popped nodes must not be contained")
+  }
+  GL_ASSERT(heap.empty(),"Heap must be empty")
+  GL_TEST_END()
+}
+
+void TestReuse ()
+{
+  GL_TEST_BEGIN("Indexed heap reuse")
+  gl::IndexedDaryHeap<int> heap(4);
+  heap.push(2,5);
+  heap.push(1,7);
+  GL_ASSERT(heap.contains(1) && heap.contains(2) && !heap.contains(0),"Wrong contents")
+  GL_ASSERT_EQUAL(heap.top().second,2)
+  heap.decrease(1,3);
+  GL_ASSERT_EQUAL(heap.top().second,1)
+  heap.clear();
+  GL_ASSERT(heap.empty() && !heap.contains(1) && !heap.contains(2),"clear must remove all nodes")
+  GL_ASSERT(heap.pushOrDecrease(1,9),"Nodes can be pushed again after clear")
+  GL_ASSERT_EQUAL(heap.pop().first,9)
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  TestHeapSort<2>();
+  TestHeapSort<3>();
+  TestHeapSort<4>();
+  TestHeapSort<8>();
+  TestReuse();
+  return 0;
+}
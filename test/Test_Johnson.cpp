@@ -0,0 +1,120 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+#include <random>
+
+template <class Graph>
+void compareWithFloydWarshall (const Graph& g, const gl::algorithm::Johnson<Graph>& johnson)
+{
+  gl::algorithm::FloydWarshall<Graph> reference(g);
+  GL_ASSERT(!johnson.hasNegativePath(),"There is no negative cycle")
+  for (gl::index_type src = 0; src < g.numNodes(); ++src) {
+    for (gl::index_type dest = 0; dest < g.numNodes(); ++dest) {
+      auto expected = reference.pathLength(src,dest);
+      auto length = johnson.pathLength(src,dest);
+      GL_ASSERT(length == expected,std::string("Wrong distance from ")+std::to_string(src)+std::string(" to ")+std::to_string(dest))
+      auto path = johnson.getPath(src,dest);
+      GL_ASSERT(path.first == !expected.isInfinite(),"getPath reports the wrong reachability")
+      if (!path.first) continue;
+      GL_ASSERT(path.second.front() == src && path.second.back() == dest,"getPath has the wrong endpoints")
+      typename Graph::val_t sum = 0;
+      for (gl::index_type i = 1; i < path.second.size(); ++i) {
+        GL_ASSERT(g.hasEdge(path.second[i-1],path.second[i]),"getPath uses a non-existing edge")
+        sum += g.getEdgeWeight(path.second[i-1],path.second[i]);
+      }
+      GL_ASSERT_EQUAL(sum,expected.scalarDistance())
+    }
+    GL_ASSERT_EQUAL(johnson.closenessCentrality(src),reference.closenessCentrality(src))
+    GL_ASSERT_EQUAL(johnson.harmonicCentrality(src),reference.harmonicCentrality(src))
+  }
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestEmptyConstructor (const std::string& type)
+{
+  GL_TEST_BEGIN("Empty constructor " << type)
+  gl::algorithm::Johnson<gl::Graph<SCALAR,STORAGE,DIRECTION>> d;
+  GL_TEST_CATCH_ERROR(d.hasNegativePath();,std::runtime_error,"Johnson::hasNegativePath | Johnson has not been initialized with a graph.")
+  GL_TEST_CATCH_ERROR(d.pathLength(0,3);,std::runtime_error,"Johnson::pathLength | Johnson has not been initialized with a graph.")
+  GL_TEST_CATCH_ERROR(d.getPath(0,3);,std::runtime_error,"Johnson::getPath | Johnson has not been initialized with a graph.")
+  GL_TEST_CATCH_ERROR(d.getSPT(0);,std::runtime_error,"Johnson::getSPT | Johnson has not been initialized with a graph.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestSmall (const std::string& type)
+{
+  GL_TEST_BEGIN("Johnson small " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::Johnson<decltype(g)> johnson(g);
+  compareWithFloydWarshall(g,johnson);
+  auto tree = johnson.getShortestPathTree(0);
+  GL_ASSERT(!tree.isReached(9),"Node 9 is not connected to 0")
+  GL_ASSERT_EQUAL_GRAPH(johnson.getSPT(0),gl::algorithm::Dijkstra<decltype(g)>(g).getSPT(0))
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestNegativeWeights (const std::string& type)
+{
+  GL_TEST_BEGIN("Johnson negative weights " << type)
+  // w(u,v) = c(u,v) + p(u) - p(v) with c > 0: negative edges, but every cycle is positive
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(60,type);
+  std::mt19937 gen(44);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  std::uniform_int_distribution<int> cost(1,10), shift(0,15);
+  std::vector<int> p(g.numNodes());
+  for (auto& x : p)
+    x = shift(gen);
+  for (int i = 0; i < 200; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(cost(gen) + p[u] - p[v]));
+  }
+  GL_ASSERT(g.numNegativeEdges() > 0,"The graph has negative edges")
+  gl::algorithm::Johnson<decltype(g)> johnson(g,4);
+  compareWithFloydWarshall(g,johnson);
+
+  // negative cycle 0 -> 1 -> 2 -> 0
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g2(4,type);
+  g2.setEdge(0,1,SCALAR(-2));
+  g2.setEdge(1,2,SCALAR(-1));
+  g2.setEdge(2,0,SCALAR(-3));
+  g2.setEdge(2,3,SCALAR(1));
+  gl::algorithm::Johnson<decltype(g2)> cycle(g2);
+  GL_ASSERT(cycle.hasNegativePath(),"No negative path was detected in g2 even though there is one")
+  GL_TEST_CATCH_ERROR({cycle.getPath(0,1);},std::runtime_error,"Johnson::getPath | The input graph has a negative cycle at node 0")
+
+  gl::Graph<SCALAR,STORAGE,gl::Undirected> g3(3,type);
+  g3.setEdge(0,1,SCALAR(-2));
+  GL_TEST_CATCH_ERROR({gl::algorithm::Johnson<decltype(g3)> d3(g3);},std::runtime_error,"Johnson::compute | Graph is undirected and contains negative weights")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestRandom (const std::string& type)
+{
+  GL_TEST_BEGIN("Johnson random " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(80,type);
+  std::mt19937 gen(45);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  std::uniform_int_distribution<int> weight(1,20);
+  for (int i = 0; i < 240; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(weight(gen)));
+  }
+  gl::algorithm::Johnson<decltype(g)> johnson(g,4);
+  compareWithFloydWarshall(g,johnson);
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestEmptyConstructor)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestSmall)
+  GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestNegativeWeights,int)
+  GL_TEST_FUNCTION_WITH_DIRECTED_TYPES(TestNegativeWeights,double)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestRandom)
+  return 0;
+}
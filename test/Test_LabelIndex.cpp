@@ -0,0 +1,76 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+void TestLookup ()
+{
+  GL_TEST_BEGIN("Lookup")
+  gl::LabelIndex index;
+  index.insert("Zurich",3);
+  index.insert("Zug",1);
+  index.insert("Bern",0);
+  index.insert("Zurich",2);
+  GL_ASSERT_EQUAL(index.size(),4)
+  GL_ASSERT(index.find("Zurich") == std::make_pair(true,gl::index_type(2)),"Smallest ID with label Zurich should be 2")
+  GL_ASSERT(!index.find("Basel").first,"Basel is not indexed")
+
+  std::vector<gl::index_type> expected {1,2,3};
+  GL_ASSERT(index.findPrefix("Zu") == expected,"Wrong prefix matches for Zu")
+  GL_ASSERT(index.findPrefix("Zurichberg").empty(),"No prefix matches expected")
+  GL_ASSERT_EQUAL(index.findPrefix("").size(),4)
+  GL_TEST_END()
+}
+
+void TestUpdate ()
+{
+  GL_TEST_BEGIN("Update")
+  gl::LabelIndex index;
+  index.insert("a",0);
+  index.insert("a",1);
+  index.update(0,"a","b");
+  GL_ASSERT(index.find("a") == std::make_pair(true,gl::index_type(1)),"Node 1 should take over label a")
+  GL_ASSERT(index.find("b") == std::make_pair(true,gl::index_type(0)),"Node 0 should be found under label b")
+  index.erase("a",1);
+  GL_ASSERT(!index.find("a").first,"Label a should be gone")
+  GL_TEST_CATCH_ERROR(index.erase("a",1);,std::runtime_error,"LabelIndex::erase | Node 1 is not indexed under label \"a\"")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestGraphLookup (const std::string& type)
+{
+  GL_TEST_BEGIN("Graph lookup " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(5);
+  g.updateNode(0,"8000 Zurich");
+  g.updateNode(1,"3000 Bern");
+  g.updateNode(2,"8400 Winterthur");
+  std::vector<gl::index_type> expected {0,2};
+
+  // without index
+  GL_ASSERT(!g.hasLabelIndex(),"Index should be disabled by default")
+  GL_ASSERT(g.findNode("3000 Bern") == std::make_pair(true,gl::index_type(1)),"Bern should be node 1")
+  GL_ASSERT(g.findNodesWithPrefix("8") == expected,"Wrong prefix matches")
+
+  // with index, kept in sync by updateNode
+  g.enableLabelIndex();
+  GL_ASSERT(g.findNode("3000 Bern") == std::make_pair(true,gl::index_type(1)),"Bern should be node 1")
+  g.updateNode(1,"8001 Zurich");
+  g.updateNode(4,std::string("4000 Basel"),gl::Color("red"));
+  GL_ASSERT(!g.findNode("3000 Bern").first,"Bern should be gone")
+  GL_ASSERT(g.findNode("4000 Basel") == std::make_pair(true,gl::index_type(4)),"Basel should be node 4")
+  expected = {0,1,2};
+  GL_ASSERT(g.findNodesWithPrefix("8") == expected,"Wrong prefix matches")
+
+  // both lookups agree
+  g.disableLabelIndex();
+  GL_ASSERT(g.findNodesWithPrefix("8") == expected,"Wrong prefix matches")
+  GL_ASSERT(g.findNode("") == std::make_pair(true,gl::index_type(3)),"Node 3 is unlabeled")
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  TestLookup();
+  TestUpdate();
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestGraphLookup)
+  return 0;
+}
@@ -0,0 +1,86 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+#include <random>
+
+template <class Graph>
+void compareWithDijkstra (const Graph& g, const gl::DistanceTable<typename Graph::val_t>& table)
+{
+  gl::algorithm::Dijkstra<Graph> reference(g);
+  for (gl::index_type i = 0; i < table.numSources(); ++i) {
+    for (gl::index_type j = 0; j < table.numTargets(); ++j) {
+      auto expected = reference.pathLength(table.sources()[i],table.targets()[j]);
+      auto distance = table(i,j);
+      GL_ASSERT(distance == expected,std::string("Wrong distance from ")+std::to_string(table.sources()[i])+std::string(" to ")+std::to_string(table.targets()[j]))
+    }
+  }
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestSmall (const std::string& type)
+{
+  GL_TEST_BEGIN("Distance table small " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(10,type); // node 9 is unreachable
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::algorithm::ManyToMany<decltype(g)> m2m(g);
+  gl::algorithm::ContractionHierarchies<decltype(g)> ch(g);
+  // duplicates and unreachable nodes on both sides
+  typename decltype(g)::idx_list_t sources {0, 4, 9, 4, 2}, targets {8, 9, 0, 3, 8, 5};
+  auto table = m2m.distanceTable(sources,targets);
+  GL_ASSERT_EQUAL(table.numSources(),5)
+  GL_ASSERT_EQUAL(table.numTargets(),6)
+  GL_ASSERT_EQUAL(table.data().size(),30)
+  GL_ASSERT(table(0,1).isInfinite(),"Node 9 is not reachable")
+  GL_ASSERT(table(2,1).isZero(),"Distance from 9 to itself")
+  GL_ASSERT_EQUAL(table(0,0).scalarDistance(),SCALAR(14))
+  compareWithDijkstra(g,table);
+  compareWithDijkstra(g,ch.distanceTable(sources,targets));
+  GL_ASSERT_EQUAL(m2m.distanceTable({},targets).data().size(),0)
+  GL_ASSERT_EQUAL(ch.distanceTable(sources,{}).data().size(),0)
+
+  GL_TEST_CATCH_ERROR(m2m.distanceTable({10},targets);,std::runtime_error,"ManyToMany::distanceTable | Node index out of range.")
+  GL_TEST_CATCH_ERROR(ch.distanceTable(sources,{10});,std::runtime_error,"ContractionHierarchies::distanceTable | Node index out of range.")
+  g.updateEdge(0,1,SCALAR(-1));
+  GL_TEST_CATCH_ERROR(gl::algorithm::ManyToMany<decltype(g)> bad(g);,std::runtime_error,
+                      "ManyToMany::ManyToMany | Found non-positive edge weights in the graph.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestRandom (const std::string& type)
+{
+  GL_TEST_BEGIN("Distance table random " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(80,type);
+  std::mt19937 gen(43);
+  std::uniform_int_distribution<gl::index_type> node(0,g.numNodes()-1);
+  std::uniform_int_distribution<int> weight(1,20);
+  for (int i = 0; i < 240; ++i) {
+    gl::index_type u = node(gen), v = node(gen);
+    if (u != v && !g.hasEdge(u,v))
+      g.setEdge(u,v,SCALAR(weight(gen)));
+  }
+  typename decltype(g)::idx_list_t sources, targets;
+  for (int i = 0; i < 30; ++i) {
+    sources.push_back(node(gen));
+    targets.push_back(node(gen));
+  }
+  gl::algorithm::ManyToMany<decltype(g)> m2m(g,4);
+  gl::algorithm::ContractionHierarchies<decltype(g)> ch(g,4);
+  auto table = m2m.distanceTable(sources,targets);
+  compareWithDijkstra(g,table);
+  auto buckets = ch.distanceTable(sources,targets,4);
+  compareWithDijkstra(g,buckets);
+  // the result does not depend on the number of threads
+  auto sequential = gl::algorithm::ManyToMany<decltype(g)>(g,1).distanceTable(sources,targets);
+  for (gl::index_type i = 0; i < table.data().size(); ++i) {
+    auto distance = table.data()[i];
+    GL_ASSERT(distance == sequential.data()[i],"Results differ between thread counts")
+  }
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestSmall)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestRandom)
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+#include <algorithm>
+#include <random>
+
+// simulates a Dijkstra run: every popped key spawns keys in [key, key+maxWeight]
+template <class Queue>
+void TestMonotoneOrder (const std::string& name, Queue queue, int maxWeight)
+{
+  GL_TEST_BEGIN(name << " with weights up to " << maxWeight)
+  std::mt19937 gen(maxWeight);
+  std::uniform_int_distribution<int> weight(0,maxWeight);
+  std::vector<std::pair<int,gl::index_type>> pushed, popped;
+  queue.push(0,0);
+  pushed.emplace_back(0,0);
+  int last = 0;
+  while (!queue.empty()) {
+    auto top = queue.pop();
+    GL_ASSERT(top.first >= last,"Popped keys must not decrease")
+    last = top.first;
+    popped.push_back(top);
+    for (int i = 0; i < 2 && pushed.size() < 2000; ++i) {
+      int key = top.first + weight(gen);
+      queue.push(key,pushed.size());
+      pushed.emplace_back(key,pushed.size());
+    }
+  }
+  GL_ASSERT_EQUAL(popped.size(),pushed.size())
+  std::sort(pushed.begin(),pushed.end());
+  std::sort(popped.begin(),popped.end());
+  GL_ASSERT(popped == pushed,"Every entry has to be popped exactly once")
+  GL_TEST_END()
+}
+
+void TestDuplicates ()
+{
+  GL_TEST_BEGIN("Monotone queues with duplicate keys")
+  gl::BucketQueue<int> buckets(3);
+  gl::RadixHeap<int> radix;
+  for (gl::index_type node : {4, 1, 7}) {
+    buckets.push(2,node);
+    radix.push(2,node);
+  }
+  buckets.push(1,0);
+  radix.push(1,0);
+  GL_ASSERT_EQUAL(buckets.size(),4)
+  GL_ASSERT_EQUAL(radix.size(),4)
+  GL_ASSERT_EQUAL(buckets.pop().second,0)
+  GL_ASSERT_EQUAL(radix.pop().second,0)
+  for (int i = 0; i < 3; ++i) {
+    GL_ASSERT_EQUAL(buckets.pop().first,2)
+    GL_ASSERT_EQUAL(radix.pop().first,2)
+  }
+  GL_ASSERT(buckets.empty() && radix.empty(),"Queues must be empty")
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  for (int maxWeight : {0, 1, 10, 300})
+    TestMonotoneOrder("Bucket queue", gl::BucketQueue<int>(maxWeight), maxWeight);
+  for (int maxWeight : {0, 1, 10, 300, 1000000})
+    TestMonotoneOrder("Radix heap", gl::RadixHeap<int>(), maxWeight);
+  TestDuplicates();
+  return 0;
+}
@@ -41,6 +41,46 @@ void TestUpdate () {
   GL_TEST_END()
 }
 
+void TestEdgeStatistics () {
+  GL_TEST_BEGIN("Edge statistics")
+  gl::Property p (3,"Property test");
+  GL_ASSERT_EQUAL(p.minWeight(), 0.)
+  GL_ASSERT_EQUAL(p.maxWeight(), 0.)
+  p.edgeAdded(4.,false);
+  p.edgeAdded(-2.,false);
+  p.edgeAdded(0.,true);
+  p.edgeAdded(-1.,true);
+  GL_ASSERT_EQUAL(p.numSelfLoops(), 2)
+  GL_ASSERT_EQUAL(p.numNegativeEdges(), 2)
+  GL_ASSERT_EQUAL(p.numNonPositiveEdges(), 1)
+  GL_ASSERT_EQUAL(p.minWeight(), -2.)
+  GL_ASSERT_EQUAL(p.maxWeight(), 4.)
+
+  p.edgeWeightChanged(-2.,3.,false);
+  p.edgeRemoved(4.,false);
+  p.edgeRemoved(-1.,true);
+  GL_ASSERT_EQUAL(p.numSelfLoops(), 1)
+  GL_ASSERT_EQUAL(p.numNegativeEdges(), 0)
+  GL_ASSERT_EQUAL(p.numNonPositiveEdges(), 0)
+  GL_ASSERT_EQUAL(p.minWeight(), 0.)
+  GL_ASSERT_EQUAL(p.maxWeight(), 3.)
+  GL_TEST_CATCH_ERROR(p.edgeRemoved(7.,false);,std::runtime_error,"Property::edgeRemoved | No edge with this weight is registered")
+
+  p.degreeChanged(0,1);
+  p.degreeChanged(1,2);
+  p.degreeChanged(0,1);
+  GL_ASSERT_EQUAL(p.maxDegree(), 2)
+  p.degreeChanged(2,1);
+  GL_ASSERT_EQUAL(p.maxDegree(), 1)
+  p.degreeChanged(1,0);
+  p.degreeChanged(1,0);
+  GL_ASSERT_EQUAL(p.maxDegree(), 0)
+
+  // statistics are not part of the identity of a property
+  GL_ASSERT(p == gl::Property(3,"Property test"), "Equality operator")
+  GL_TEST_END()
+}
+
 void TestEqualityOperator () {
   GL_TEST_BEGIN("Equality Operator")
   gl::Property p1(5,"Property test");
@@ -81,6 +121,7 @@ int main(int argc, char const *argv[])
 {
   TestConstructor();
   TestUpdate();
+  TestEdgeStatistics();
   TestEqualityOperator();
   TestInequalityOperator();
   return 0;
@@ -0,0 +1,104 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestView (const std::string& type)
+{
+  GL_TEST_BEGIN("View " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(9,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+
+  auto view = gl::SharedGraph<decltype(g)>::view(g);
+  GL_ASSERT(view.get() == &g,"A view must reference the original graph.")
+  GL_ASSERT(!view.isOwner(),"A view must not own the graph.")
+  GL_ASSERT_EQUAL(view.useCount(),0)
+
+  auto copy = view;
+  GL_ASSERT(copy.get() == &g,"Copying a view must not copy the graph.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestCopyOnWrite (const std::string& type)
+{
+  GL_TEST_BEGIN("Copy-on-write " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(9,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+
+  gl::SharedGraph<decltype(g)> one = gl::SharedGraph<decltype(g)>::copy(g);
+  auto two = one;
+  GL_ASSERT(one.get() == two.get(),"Handles must share the same graph.")
+  GL_ASSERT_EQUAL(one.useCount(),2)
+
+  two.mutate().updateEdge(0,1,SCALAR(42));
+  GL_ASSERT(one.get() != two.get(),"Writing to a shared graph must detach the writer.")
+  GL_ASSERT_EQUAL(one->getEdgeWeight(0,1),SCALAR(4))
+  GL_ASSERT_EQUAL(two->getEdgeWeight(0,1),SCALAR(42))
+  GL_ASSERT_EQUAL(one.useCount(),1)
+
+  // exclusive owner writes in place
+  auto address = two.get();
+  two.mutate().updateEdge(0,1,SCALAR(43));
+  GL_ASSERT(address == two.get(),"An exclusive owner must not copy on write.")
+
+  // writing through a view never touches the viewed graph
+  auto view = gl::SharedGraph<decltype(g)>::view(g);
+  view.mutate().updateEdge(0,1,SCALAR(44));
+  GL_ASSERT_EQUAL(g.getEdgeWeight(0,1),SCALAR(4))
+  GL_ASSERT_EQUAL(view->getEdgeWeight(0,1),SCALAR(44))
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestAlgorithms (const std::string& type)
+{
+  GL_TEST_BEGIN("Algorithms on shared graphs " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(9,type);
+  g.setEdgesFromListFile("../../test/input/dijkstra9");
+  gl::SharedGraph<decltype(g)> shared = gl::SharedGraph<decltype(g)>::copy(g);
+
+  gl::algorithm::Dijkstra<decltype(g)> d(shared);
+  gl::algorithm::FloydWarshall<decltype(g)> fw(shared);
+  GL_ASSERT_EQUAL(shared.useCount(),3)
+  GL_ASSERT(d.pathLength(0,4) == fw.pathLength(0,4),"Dijkstra and FloydWarshall disagree.")
+
+  // temporaries are owned by the algorithm
+  gl::algorithm::Dijkstra<decltype(g)> owner ((gl::Graph<SCALAR,STORAGE,DIRECTION>(g)));
+  GL_ASSERT(owner.pathLength(0,4) == d.pathLength(0,4),"Owning Dijkstra disagrees.")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestEdgeSelector (const std::string& type)
+{
+  GL_TEST_BEGIN("Edge selector from shared graphs " << type)
+  using Graph = gl::Graph<SCALAR,STORAGE,DIRECTION>;
+  auto makePath = [&type]() {
+    Graph path(3,type);
+    path.setEdge(0,1,SCALAR(1));
+    path.setEdge(1,2,SCALAR(1));
+    return path;
+  };
+  Graph g = makePath();
+  auto shared = gl::SharedGraph<Graph>::copy(g);
+  // views, shared handles and owned temporaries
+  auto viewed = gl::interface::getEdgeSelectorFromGraph(g);
+  auto handled = gl::interface::getEdgeSelectorFromGraph(shared);
+  auto moved = gl::interface::getEdgeSelectorFromGraph(gl::SharedGraph<Graph>(makePath()));
+  auto owned = gl::interface::getEdgeSelectorFromGraph(makePath());
+  for (auto* selector : {&viewed, &handled, &moved, &owned}) {
+    GL_ASSERT((*selector)(1,2).first,"(1,2) is an edge")
+    GL_ASSERT(!(*selector)(0,2).first,"(0,2) is not an edge")
+  }
+  GL_ASSERT_EQUAL(shared.useCount(),2)
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestView)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestCopyOnWrite)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestAlgorithms)
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestEdgeSelector)
+  return 0;
+}
@@ -0,0 +1,112 @@
+#include <graphlib/gl>
+#include "gl_test.hpp"
+
+#include <random>
+
+using point_t = gl::SpatialIndex::point_t;
+
+std::vector<gl::index_type> bruteNearest (const std::vector<point_t>& points, const point_t& q, gl::index_type k)
+{
+  std::vector<std::pair<double,gl::index_type>> d;
+  for (gl::index_type i = 0; i < points.size(); ++i) {
+    double dx = double(points[i].first) - q.first, dy = double(points[i].second) - q.second;
+    d.emplace_back(dx*dx+dy*dy,i);
+  }
+  std::sort(d.begin(),d.end());
+  std::vector<gl::index_type> out;
+  for (gl::index_type i = 0; i < std::min(k,gl::index_type(d.size())); ++i)
+    out.push_back(d[i].second);
+  return out;
+}
+
+std::vector<gl::index_type> bruteRange (const std::vector<point_t>& points, const point_t& lo, const point_t& hi)
+{
+  std::vector<gl::index_type> out;
+  for (gl::index_type i = 0; i < points.size(); ++i)
+    if (points[i].first >= lo.first && points[i].first <= hi.first && points[i].second >= lo.second && points[i].second <= hi.second)
+      out.push_back(i);
+  return out;
+}
+
+void TestEmpty ()
+{
+  GL_TEST_BEGIN("Empty index")
+  gl::SpatialIndex index;
+  GL_ASSERT_EQUAL(index.size(),0)
+  GL_ASSERT(index.nearest({0.f,0.f},3).empty(),"No points expected")
+  GL_ASSERT(index.range({-1.f,-1.f},{1.f,1.f}).empty(),"No points expected")
+  GL_TEST_CATCH_ERROR(index.update(0,{1.f,1.f});,std::runtime_error,"SpatialIndex::update | Point 0 is not indexed")
+  GL_TEST_END()
+}
+
+void TestQueries ()
+{
+  GL_TEST_BEGIN("Queries against brute force")
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<float> coord(-50.f,50.f);
+  std::vector<point_t> points(500);
+  for (auto& p : points) p = {coord(gen),coord(gen)};
+  points[7] = points[3]; // duplicate position
+  gl::SpatialIndex index(points);
+  GL_ASSERT_EQUAL(index.size(),500)
+
+  std::uniform_real_distribution<float> query(-80.f,80.f); // includes queries outside of the grid
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 50; ++i) {
+      point_t q {query(gen),query(gen)};
+      for (gl::index_type k : {1,5,40})
+        GL_ASSERT(index.nearest(q,k) == bruteNearest(points,q,k),"Nearest query differs from brute force")
+      point_t a {query(gen),query(gen)}, b {query(gen),query(gen)};
+      point_t lo {std::min(a.first,b.first),std::min(a.second,b.second)};
+      point_t hi {std::max(a.first,b.first),std::max(a.second,b.second)};
+      GL_ASSERT(index.range(lo,hi) == bruteRange(points,lo,hi),"Range query differs from brute force")
+    }
+    // move points, some of them far outside of the current grid
+    for (int i = 0; i < 100; ++i) {
+      gl::index_type id = gen() % points.size();
+      points[id] = (i % 20 == 0) ? point_t{coord(gen)*4,coord(gen)*4} : point_t{coord(gen),coord(gen)};
+      index.update(id,points[id]);
+    }
+  }
+  GL_ASSERT(index.nearest({0.f,0.f},1000).size() == 500,"k larger than size should return all points")
+  GL_TEST_END()
+}
+
+template <class SCALAR, class STORAGE, class DIRECTION>
+void TestGraphQueries (const std::string& type)
+{
+  GL_TEST_BEGIN("Graph queries " << type)
+  gl::Graph<SCALAR,STORAGE,DIRECTION> g(6);
+  for (gl::index_type i = 0; i < 6; ++i)
+    g.updateNode(i,std::make_pair(float(i),float(i%2)));
+  std::vector<gl::index_type> nearest {2,3,1};
+  std::vector<gl::index_type> inRange {1,3};
+
+  GL_ASSERT(!g.hasSpatialIndex(),"Index should be disabled by default")
+  GL_ASSERT(g.findNearestNodes({2.1f,0.2f},3) == nearest,"Wrong nearest nodes")
+  GL_ASSERT(g.findNodesInRange({0.5f,0.5f},{3.5f,1.f}) == inRange,"Wrong nodes in range")
+
+  g.enableSpatialIndex();
+  GL_ASSERT(g.findNearestNodes({2.1f,0.2f},3) == nearest,"Wrong nearest nodes")
+  GL_ASSERT(g.findNodesInRange({0.5f,0.5f},{3.5f,1.f}) == inRange,"Wrong nodes in range")
+
+  // the index follows position updates
+  g.updateNode(5,std::make_pair(2.1f,0.25f),gl::Color("red"));
+  g.updateNode(3,std::make_pair(100.f,100.f));
+  nearest = {5,2,1};
+  inRange = {1};
+  GL_ASSERT(g.findNearestNodes({2.1f,0.2f},3) == nearest,"Wrong nearest nodes after update")
+  GL_ASSERT(g.findNodesInRange({0.5f,0.5f},{3.5f,1.f}) == inRange,"Wrong nodes in range after update")
+  GL_ASSERT(g.findNearestNodes({90.f,90.f})[0] == 3,"Moved node should be found")
+  g.disableSpatialIndex();
+  GL_ASSERT(g.findNearestNodes({2.1f,0.2f},3) == nearest,"Wrong nearest nodes without index")
+  GL_TEST_END()
+}
+
+int main(int argc, char const *argv[])
+{
+  TestEmpty();
+  TestQueries();
+  GL_TEST_FUNCTION_WITH_ALL_TYPES(TestGraphQueries)
+  return 0;
+}